@@ -0,0 +1,99 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Shared topology of the columns of a subsurface mesh.
+
+#include <map>
+#include <utility>
+
+#include "errors.hh"
+#include "ColumnBatch.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+ColumnBatch::ColumnBatch(const AmanziMesh::Mesh& mesh)
+  : contiguous_(true)
+{
+  int ncols = mesh.num_columns(false);
+  column_shapes_.resize(ncols);
+  offsets_.resize(ncols+1, 0);
+  first_cells_.resize(ncols, 0);
+
+  std::map<int, int> shape_of_ncells;
+  for (int col=0; col!=ncols; ++col) {
+    const auto& col_cells = mesh.cells_of_column(col);
+    const auto& col_faces = mesh.faces_of_column(col);
+    int ncells = col_cells.size();
+    if (col_faces.size() != col_cells.size() + 1) {
+      Errors::Message msg;
+      msg << "ColumnBatch: column " << col << " has " << ncells << " cells but "
+          << col_faces.size() << " faces.";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    auto shape = shape_of_ncells.emplace(ncells, shape_ncells_.size());
+    if (shape.second) shape_ncells_.push_back(ncells);
+    column_shapes_[col] = shape.first->second;
+    offsets_[col+1] = offsets_[col] + ncells;
+
+    if (ncells > 0) first_cells_[col] = col_cells[0];
+    for (int k=1; k<ncells; ++k) {
+      if (col_cells[k] != col_cells[0] + k) contiguous_ = false;
+    }
+    faces_.insert(faces_.end(), col_faces.begin(), col_faces.end());
+  }
+
+  if (!contiguous_) {
+    cells_.reserve(offsets_[ncols]);
+    for (int col=0; col!=ncols; ++col) {
+      const auto& col_cells = mesh.cells_of_column(col);
+      cells_.insert(cells_.end(), col_cells.begin(), col_cells.end());
+    }
+    first_cells_.clear();
+    first_cells_.shrink_to_fit();
+  }
+  faces_.shrink_to_fit();
+}
+
+
+std::size_t ColumnBatch::bytes() const
+{
+  return sizeof(*this)
+    + shape_ncells_.capacity() * sizeof(int)
+    + column_shapes_.capacity() * sizeof(int)
+    + offsets_.capacity() * sizeof(int)
+    + (first_cells_.capacity() + cells_.capacity() + faces_.capacity())
+        * sizeof(AmanziMesh::Entity_ID);
+}
+
+
+Teuchos::RCP<const ColumnBatch>
+ColumnBatch::Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  // Entries hold the mesh weakly, so that a mesh that is released (e.g. the
+  // unordered mesh replaced by "reorder cells by column") is not kept alive,
+  // and its address, if reused, is not mistaken for it.
+  using Entry = std::pair<Teuchos::RCP<const AmanziMesh::Mesh>,
+                          Teuchos::RCP<const ColumnBatch> >;
+  static std::map<const AmanziMesh::Mesh*, Entry> batches;
+
+  for (auto entry = batches.begin(); entry != batches.end(); ) {
+    if (entry->second.first.is_valid_ptr()) ++entry;
+    else entry = batches.erase(entry);
+  }
+
+  auto& entry = batches[mesh.get()];
+  if (entry.second == Teuchos::null) {
+    entry.first = mesh.create_weak();
+    entry.second = Teuchos::rcp(new ColumnBatch(*mesh));
+  }
+  return entry.second;
+}
+
+} //namespace
+} //namespace
@@ -0,0 +1,86 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Shared topology of the columns of a subsurface mesh.
+
+/*!
+
+A domain set of columns, one per surface cell, normally builds a column mesh
+(and a column surface mesh) per column, each with its own maps, parameter
+list, fields, and evaluators.  For large numbers of identical columns this
+per-column overhead dominates setup time and memory.
+
+A ColumnBatch instead describes all columns of the (already built) columns of
+a subsurface mesh at once.  Columns with the same number of cells share one
+shape; per column only its shape and the offset of its cells are stored.  When
+the parent mesh's cells are numbered column by column (see `"reorder cells by
+column`"), the cells of each column are a contiguous block of the parent's
+cell numbering and are not stored at all, so that a column of any parent
+field is a contiguous slice of that field.
+
+One ColumnBatch is shared by all users of a mesh, see Get().
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class ColumnBatch {
+ public:
+  // Columns of mesh, which must have been built, numbered as the mesh's
+  // columns.
+  explicit ColumnBatch(const AmanziMesh::Mesh& mesh);
+
+  int num_columns() const { return column_shapes_.size(); }
+
+  // Columns with the same number of cells share a shape.
+  int num_shapes() const { return shape_ncells_.size(); }
+  int shape(int col) const { return column_shapes_[col]; }
+  int num_cells(int col) const { return shape_ncells_[column_shapes_[col]]; }
+
+  // Are the cells of every column consecutive, top to bottom, in the
+  // parent's numbering?
+  bool contiguous() const { return contiguous_; }
+
+  // k-th cell from the top of column col
+  AmanziMesh::Entity_ID cell(int col, int k) const {
+    return contiguous_ ? first_cells_[col] + k : cells_[offsets_[col] + k];
+  }
+
+  // Faces of column col are numbered face_offset(col) + k, k in
+  // [0, num_cells(col)], top to bottom, so that face k is above cell k.
+  int face_offset(int col) const { return offsets_[col] + col; }
+  int num_faces() const { return faces_.size(); }
+  AmanziMesh::Entity_ID face(int col, int k) const { return faces_[face_offset(col) + k]; }
+
+  // memory held, in bytes
+  std::size_t bytes() const;
+
+  // The ColumnBatch of mesh, built on first use and shared by all callers
+  // while mesh exists.
+  static Teuchos::RCP<const ColumnBatch>
+  Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+ private:
+  bool contiguous_;
+  std::vector<int> shape_ncells_;
+  std::vector<int> column_shapes_;
+  std::vector<int> offsets_;                        // cells before each column
+  std::vector<AmanziMesh::Entity_ID> first_cells_;  // if contiguous
+  std::vector<AmanziMesh::Entity_ID> cells_;        // if not contiguous
+  std::vector<AmanziMesh::Entity_ID> faces_;
+};
+
+} //namespace
+} //namespace
@@ -0,0 +1,191 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Computes several column diagnostics of subsurface fields in one sweep.
+
+#include "ColumnDiagnosticsEvaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+ColumnDiagnosticsEvaluator::ColumnDiagnosticsEvaluator(Teuchos::ParameterList& plist)
+    : SecondaryVariablesFieldEvaluator(plist),
+      updated_once_(false)
+{
+  Key a_key = Keys::cleanPListName(plist_.name());
+  surf_domain_ = Keys::getDomain(a_key);
+  if (surf_domain_ == "surface") {
+    domain_ = "";
+    domain_ = plist_.get<std::string>("column domain name", domain_);
+  } else if (Keys::starts_with(surf_domain_, "surface_")) {
+    domain_ = surf_domain_.substr(8, surf_domain_.size());
+    domain_ = plist_.get<std::string>("column domain name", domain_);
+  } else {
+    domain_ = plist_.get<std::string>("column domain name");
+  }
+
+  Teuchos::ParameterList& diag_list = plist_.sublist("diagnostics");
+  for (auto it = diag_list.begin(); it != diag_list.end(); ++it) {
+    std::string name = diag_list.name(it);
+    if (!diag_list.isSublist(name)) {
+      Errors::Message msg;
+      msg << "ColumnDiagnosticsEvaluator: \"diagnostics\" entry \"" << name << "\" is not a sublist.";
+      Exceptions::amanzi_throw(msg);
+    }
+    Teuchos::ParameterList& sublist = diag_list.sublist(name);
+
+    Diagnostic_ diag;
+    std::string reduction = sublist.get<std::string>("reduction");
+    if (reduction == "depth to first below") {
+      diag.type = ColumnReduction::DEPTH_TO_FIRST_BELOW;
+    } else if (reduction == "depth to first equal") {
+      diag.type = ColumnReduction::DEPTH_TO_FIRST_EQUAL;
+    } else if (reduction == "sum") {
+      diag.type = ColumnReduction::SUM;
+    } else if (reduction == "average") {
+      diag.type = ColumnReduction::AVERAGE;
+    } else {
+      Errors::Message msg;
+      msg << "ColumnDiagnosticsEvaluator: unknown reduction \"" << reduction << "\" for diagnostic \""
+          << name << "\".  Valid are \"depth to first below\", \"depth to first equal\", \"sum\", and \"average\".";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    diag.field_key = Keys::readKey(sublist, domain_, "field");
+    diag.threshold = sublist.get<double>("threshold", 0.);
+    diag.coef = sublist.get<double>("coefficient", 1.);
+    diag.volume_factor = sublist.get<bool>("include volume factor", false);
+    diag.divide_by_density = sublist.get<bool>("divide by density", false);
+
+    dependencies_.insert(diag.field_key);
+    if (diag.volume_factor) {
+      cv_key_ = Keys::readKey(plist_, domain_, "cell volume", "cell_volume");
+      dependencies_.insert(cv_key_);
+      if (diag.type == ColumnReduction::SUM) {
+        surf_cv_key_ = Keys::readKey(plist_, surf_domain_, "surface cell volume", "cell_volume");
+        dependencies_.insert(surf_cv_key_);
+      }
+    }
+    if (diag.divide_by_density) {
+      molar_dens_key_ = Keys::readKey(plist_, domain_, "molar density", "molar_density_liquid");
+      dependencies_.insert(molar_dens_key_);
+    }
+
+    my_keys_.push_back(Keys::getKey(surf_domain_, name));
+    diagnostics_.push_back(diag);
+  }
+
+  if (my_keys_.empty()) {
+    Errors::Message msg("ColumnDiagnosticsEvaluator: \"diagnostics\" list is empty.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void
+ColumnDiagnosticsEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
+        const std::vector<Teuchos::Ptr<CompositeVector> >& results)
+{
+  if (columns_ == Teuchos::null) {
+    columns_ = Teuchos::rcp(new ColumnReductions(*S->GetMesh(surf_domain_), S->GetMesh(domain_)));
+  } else if (S->IsDeformableMesh(domain_)) {
+    columns_->UpdateElevations(*S->GetMesh(domain_));
+  }
+
+  const double* cv = nullptr;
+  const double* surf_cv = nullptr;
+  const double* dens = nullptr;
+  if (!cv_key_.empty())
+    cv = (*S->GetFieldData(cv_key_)->ViewComponent("cell", false))[0];
+  if (!surf_cv_key_.empty())
+    surf_cv = (*S->GetFieldData(surf_cv_key_)->ViewComponent("cell", false))[0];
+  if (!molar_dens_key_.empty())
+    dens = (*S->GetFieldData(molar_dens_key_)->ViewComponent("cell", false))[0];
+
+  std::vector<ColumnReduction> reductions;
+  reductions.reserve(diagnostics_.size());
+  for (int i=0; i!=(int) diagnostics_.size(); ++i) {
+    const Diagnostic_& diag = diagnostics_[i];
+    const double* values = (*S->GetFieldData(diag.field_key)->ViewComponent("cell", false))[0];
+    double* result = (*results[i]->ViewComponent("cell", false))[0];
+
+    ColumnReduction red(diag.type, values, result);
+    red.threshold = diag.threshold;
+    red.coef = diag.coef;
+    if (diag.volume_factor) {
+      red.multiplier = cv;
+      if (diag.type == ColumnReduction::SUM) red.surface_divisor = surf_cv;
+    }
+    if (diag.divide_by_density) red.divisor = dens;
+    reductions.push_back(red);
+  }
+
+  columns_->Evaluate(reductions);
+}
+
+
+void
+ColumnDiagnosticsEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
+        Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> >& results)
+{
+  Errors::Message msg("ColumnDiagnosticsEvaluator: cannot differentiate with respect to anything.");
+  Exceptions::amanzi_throw(msg);
+}
+
+
+// Custom HasFieldChanged forces this to be updated once.
+bool
+ColumnDiagnosticsEvaluator::HasFieldChanged(const Teuchos::Ptr<State>& S,
+        Key request)
+{
+  bool changed = SecondaryVariablesFieldEvaluator::HasFieldChanged(S,request);
+
+  if (!updated_once_) {
+    UpdateField_(S);
+    updated_once_ = true;
+    return true;
+  }
+  return changed;
+}
+
+
+// Custom EnsureCompatibility deals with two meshes
+void
+ColumnDiagnosticsEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
+{
+  CompositeVectorSpace surf_fac;
+  surf_fac.SetMesh(S->GetMesh(surf_domain_))
+      ->SetGhosted()
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+
+  CompositeVectorSpace ss_fac;
+  ss_fac.SetMesh(S->GetMesh(domain_))
+      ->SetGhosted()
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+
+  for (const auto& my_key : my_keys_) {
+    S->RequireField(my_key, my_key)->Update(surf_fac);
+
+    // check plist for vis or checkpointing control
+    bool io_my_key = plist_.get<bool>(std::string("visualize ")+my_key, true);
+    S->GetField(my_key, my_key)->set_io_vis(io_my_key);
+    bool checkpoint_my_key = plist_.get<bool>(std::string("checkpoint ")+my_key, false);
+    S->GetField(my_key, my_key)->set_io_checkpoint(checkpoint_my_key);
+  }
+
+  for (const auto& dep_key : dependencies_) {
+    if (Keys::getDomain(dep_key) == surf_domain_) {
+      S->RequireField(dep_key)->Update(surf_fac);
+    } else {
+      S->RequireField(dep_key)->Update(ss_fac);
+    }
+    S->RequireFieldEvaluator(dep_key)->EnsureCompatibility(S);
+  }
+}
+
+} //namespace
+} //namespace
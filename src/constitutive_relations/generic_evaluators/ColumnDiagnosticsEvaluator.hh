@@ -0,0 +1,116 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Computes several column diagnostics of subsurface fields in one sweep.
+
+/*!
+
+Thaw depth, water table depth, and vertical sums and averages are each
+reductions of a subsurface field over the columns below surface cells.
+Requesting many of these as separate evaluators walks every column, and
+queries the mesh for its cells and face centroids, once per diagnostic.
+This evaluator computes any number of them, each as a surface field, in a
+single sweep over cached column structure (see ColumnReductions).
+
+Each sublist of `"diagnostics`" names one output, a variable on the surface
+domain, computed as one of the following reductions:
+
+- `"depth to first below`" Depth, relative to the surface, of the top of the
+  first cell in which the field is below `"threshold`".  With temperature and
+  a threshold just above freezing, this is the thaw depth.
+- `"depth to first equal`" Depth of the top of the first cell in which the
+  field equals `"threshold`".  With gas saturation and a threshold of 0, this
+  is the water table depth.
+- `"sum`" Sum of the field over the column.
+- `"average`" Average of the field over the column.
+
+If no cell in a column matches, depths are NaN.
+
+.. _column-diagnostics-evaluator-spec:
+.. admonition:: column-diagnostics-evaluator-spec
+
+    * `"diagnostics`" ``[column-diagnostic-spec-list]`` One sublist per output.
+
+    * `"column domain name`" ``[string]`` **"domain"** The domain of the
+      subsurface mesh, determined from the surface domain as in the
+      `"column sum evaluator`".
+
+.. _column-diagnostic-spec:
+.. admonition:: column-diagnostic-spec
+
+    * `"reduction`" ``[string]`` One of `"depth to first below`", `"depth to
+      first equal`", `"sum`", or `"average`".
+    * `"field key`" ``[string]`` The subsurface field to reduce.
+    * `"threshold`" ``[double]`` **0** Used by the depth reductions.
+    * `"coefficient`" ``[double]`` **1** Multiplies sums and averages.
+    * `"include volume factor`" ``[bool]`` **false** For sums, multiply by
+      subsurface cell volume and divide by surface cell area; for averages,
+      weight by cell volume.
+    * `"divide by density`" ``[bool]`` **false** For sums, divide the summand
+      by the subsurface molar density of liquid.
+
+*/
+
+#pragma once
+
+#include "Factory.hh"
+#include "secondary_variables_field_evaluator.hh"
+#include "ColumnReductions.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class ColumnDiagnosticsEvaluator : public SecondaryVariablesFieldEvaluator {
+
+ public:
+  explicit
+  ColumnDiagnosticsEvaluator(Teuchos::ParameterList& plist);
+  ColumnDiagnosticsEvaluator(const ColumnDiagnosticsEvaluator& other) = default;
+
+  virtual Teuchos::RCP<FieldEvaluator> Clone() const override {
+    return Teuchos::rcp(new ColumnDiagnosticsEvaluator(*this));
+  }
+
+  // Custom HasFieldChanged forces this to be updated once.
+  virtual bool HasFieldChanged(const Teuchos::Ptr<State>& S, Key request) override;
+  // Custom EnsureCompatibility deals with two meshes
+  virtual void EnsureCompatibility(const Teuchos::Ptr<State>& S) override;
+
+ protected:
+  // Required methods from SecondaryVariablesFieldEvaluator
+  virtual void EvaluateField_(const Teuchos::Ptr<State>& S,
+          const std::vector<Teuchos::Ptr<CompositeVector> >& results) override;
+  virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
+          Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> >& results) override;
+
+ protected:
+  // one per entry of my_keys_
+  struct Diagnostic_ {
+    ColumnReduction::Type type;
+    Key field_key;
+    double threshold;
+    double coef;
+    bool volume_factor;
+    bool divide_by_density;
+  };
+  std::vector<Diagnostic_> diagnostics_;
+
+  Key domain_;
+  Key surf_domain_;
+  Key cv_key_;
+  Key surf_cv_key_;
+  Key molar_dens_key_;
+
+  Teuchos::RCP<ColumnReductions> columns_;
+  bool updated_once_;
+
+ private:
+  static Utils::RegisteredFactory<FieldEvaluator,ColumnDiagnosticsEvaluator> factory_;
+};
+
+} //namespace
+} //namespace
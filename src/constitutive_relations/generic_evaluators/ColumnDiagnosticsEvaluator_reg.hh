@@ -0,0 +1,20 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "ColumnDiagnosticsEvaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// registry of method
+Utils::RegisteredFactory<FieldEvaluator, ColumnDiagnosticsEvaluator> ColumnDiagnosticsEvaluator::factory_("column diagnostics");
+
+}
+}
@@ -0,0 +1,124 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Vertical reductions of subsurface fields onto surface columns.
+
+#include <limits>
+
+#include "errors.hh"
+#include "ColumnReductions.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+ColumnReductions::ColumnReductions(const AmanziMesh::Mesh& surf_mesh,
+        const Teuchos::RCP<const AmanziMesh::Mesh>& subsurf_mesh)
+  : columns_(ColumnBatch::Get(subsurf_mesh))
+{
+  int ncols = surf_mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  if (ncols > columns_->num_columns()) {
+    Errors::Message msg;
+    msg << "ColumnReductions: surface mesh has " << ncols << " cells but subsurface mesh has "
+        << columns_->num_columns() << " columns; were columns built?";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  top_faces_.resize(ncols);
+  for (int sc=0; sc!=ncols; ++sc) {
+    top_faces_[sc] = surf_mesh.entity_get_parent(AmanziMesh::CELL, sc);
+  }
+
+  UpdateElevations(*subsurf_mesh);
+}
+
+
+void ColumnReductions::UpdateElevations(const AmanziMesh::Mesh& subsurf_mesh)
+{
+  int z_dim = subsurf_mesh.space_dimension() - 1;
+
+  z_faces_.resize(columns_->num_faces());
+  for (int sc=0; sc!=(int) top_faces_.size(); ++sc) {
+    int offset = columns_->face_offset(sc);
+    for (int i=0; i!=columns_->num_cells(sc); ++i) {
+      z_faces_[offset+i] = subsurf_mesh.face_centroid(columns_->face(sc, i))[z_dim];
+    }
+  }
+
+  z_top_.resize(top_faces_.size());
+  for (int sc=0; sc!=(int) top_faces_.size(); ++sc) {
+    z_top_[sc] = subsurf_mesh.face_centroid(top_faces_[sc])[z_dim];
+  }
+}
+
+
+void ColumnReductions::Evaluate(const std::vector<ColumnReduction>& reductions) const
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  for (int sc=0; sc!=(int) top_faces_.size(); ++sc) {
+    int ncells = columns_->num_cells(sc);
+    int offset = columns_->face_offset(sc);
+
+    for (const auto& red : reductions) {
+      switch (red.type) {
+        case ColumnReduction::DEPTH_TO_FIRST_BELOW: {
+          double z = nan;
+          for (int i=0; i!=ncells; ++i) {
+            if (red.values[columns_->cell(sc, i)] < red.threshold) {
+              z = z_faces_[offset+i];
+              break;
+            }
+          }
+          red.result[sc] = z_top_[sc] - z;
+          break;
+        }
+
+        case ColumnReduction::DEPTH_TO_FIRST_EQUAL: {
+          double z = nan;
+          for (int i=0; i!=ncells; ++i) {
+            if (red.values[columns_->cell(sc, i)] == red.threshold) {
+              z = z_faces_[offset+i];
+              break;
+            }
+          }
+          red.result[sc] = z_top_[sc] - z;
+          break;
+        }
+
+        case ColumnReduction::SUM: {
+          double sum = 0.;
+          for (int i=0; i!=ncells; ++i) {
+            AmanziMesh::Entity_ID c = columns_->cell(sc, i);
+            double val = red.values[c];
+            if (red.multiplier) val *= red.multiplier[c];
+            if (red.divisor) val /= red.divisor[c];
+            sum += val;
+          }
+          if (red.surface_divisor) sum /= red.surface_divisor[sc];
+          red.result[sc] = red.coef * sum;
+          break;
+        }
+
+        case ColumnReduction::AVERAGE: {
+          double sum = 0.;
+          double weight = 0.;
+          for (int i=0; i!=ncells; ++i) {
+            AmanziMesh::Entity_ID c = columns_->cell(sc, i);
+            double w = red.multiplier ? red.multiplier[c] : 1.;
+            sum += w * red.values[c];
+            weight += w;
+          }
+          red.result[sc] = weight > 0. ? red.coef * sum / weight : 0.;
+          break;
+        }
+      }
+    }
+  }
+}
+
+} //namespace
+} //namespace
@@ -0,0 +1,88 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Vertical reductions of subsurface fields onto surface columns.
+
+/*!
+
+Column diagnostics (thaw depth, water table depth, column sums, ...) reduce a
+subsurface field over the cells of each column below a surface cell.  Asking
+the mesh for the cells and faces of each column, and the centroid of each
+face, every time a diagnostic is evaluated is expensive relative to the
+reduction itself.  This class uses the column topology shared by all users
+of the subsurface mesh (see ColumnBatch), caches, once, the elevation of the
+face above each cell, and evaluates any number of reductions in one sweep over the columns, so that all
+reductions of a column use its cells while they are in cache.
+
+If the subsurface mesh deforms, elevations must be updated with
+UpdateElevations(); the topology is assumed fixed.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+#include "ColumnBatch.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// A single reduction, writing one value per column into result.
+struct ColumnReduction {
+  enum Type {
+    DEPTH_TO_FIRST_BELOW,  // depth to the top of the first cell with value < threshold
+    DEPTH_TO_FIRST_EQUAL,  // depth to the top of the first cell with value == threshold
+    SUM,                   // coef * sum(value * multiplier / divisor) / surface_divisor
+    AVERAGE                // coef * sum(value * multiplier) / sum(multiplier)
+  };
+
+  ColumnReduction(Type type_, const double* values_, double* result_) :
+      type(type_),
+      values(values_),
+      multiplier(nullptr),
+      divisor(nullptr),
+      surface_divisor(nullptr),
+      threshold(0.),
+      coef(1.),
+      result(result_) {}
+
+  Type type;
+  const double* values;           // subsurface cells
+  const double* multiplier;       // subsurface cells, optional
+  const double* divisor;          // subsurface cells, optional
+  const double* surface_divisor;  // surface cells, optional
+  double threshold;
+  double coef;
+  double* result;                 // surface cells
+};
+
+
+class ColumnReductions {
+ public:
+  ColumnReductions(const AmanziMesh::Mesh& surf_mesh,
+                   const Teuchos::RCP<const AmanziMesh::Mesh>& subsurf_mesh);
+
+  // Recompute elevations, for deforming meshes.
+  void UpdateElevations(const AmanziMesh::Mesh& subsurf_mesh);
+
+  // Evaluate all reductions in one sweep over the columns.
+  void Evaluate(const std::vector<ColumnReduction>& reductions) const;
+
+  int num_columns() const { return top_faces_.size(); }
+
+ private:
+  Teuchos::RCP<const ColumnBatch> columns_;
+  std::vector<AmanziMesh::Entity_ID> top_faces_;  // top face of each column
+  std::vector<double> z_faces_;                   // indexed as columns_ faces
+  std::vector<double> z_top_;
+};
+
+} //namespace
+} //namespace
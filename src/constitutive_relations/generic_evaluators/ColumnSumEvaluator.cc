@@ -54,7 +54,11 @@ ColumnSumEvaluator::ColumnSumEvaluator(const ColumnSumEvaluator& other) :
   dep_key_(other.dep_key_),
   cv_key_(other.cv_key_),
   surf_cv_key_(other.surf_cv_key_),
-  molar_dens_key_(other.molar_dens_key_) {}
+  molar_dens_key_(other.molar_dens_key_),
+  domain_(other.domain_),
+  surf_domain_(other.surf_domain_),
+  columns_(other.columns_),
+  updated_once_(false) {}
 
 
 Teuchos::RCP<FieldEvaluator>
@@ -71,57 +75,21 @@ ColumnSumEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
   const Epetra_MultiVector& dep_c = *S->GetFieldData(dep_key_)->ViewComponent("cell", false);
 
-  if (cv_key_ != "") {
-    const Epetra_MultiVector& cv = *S->GetFieldData(cv_key_)->ViewComponent("cell", false);
-    const Epetra_MultiVector& surf_cv = *S->GetFieldData(surf_cv_key_)->ViewComponent("cell", false);
-
-    if (molar_dens_key_ != "") {
-      const Epetra_MultiVector& dens = *S->GetFieldData(molar_dens_key_)->ViewComponent("cell",false);
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i] * cv[0][i] / dens[0][i];
-        }
-        res_c[0][c] = coef_ * sum / surf_cv[0][c];
-      }
-    } else {
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i] * cv[0][i];
-        }
-        res_c[0][c] = coef_ * sum / surf_cv[0][c];
-      }
-    }
+  if (columns_ == Teuchos::null) {
+    columns_ = Teuchos::rcp(new ColumnReductions(*S->GetMesh(surf_domain_), S->GetMesh(domain_)));
+  }
 
-  } else {
-    if (molar_dens_key_ != "") {
-      const Epetra_MultiVector& dens = *S->GetFieldData(molar_dens_key_)->ViewComponent("cell",false);
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i] / dens[0][i];
-        }
-        res_c[0][c] = coef_ * sum;
-      }
-    } else {
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i];
-        }
-        res_c[0][c] = coef_ * sum;
-      }
-    }
+  std::vector<ColumnReduction> reductions(1,
+          ColumnReduction(ColumnReduction::SUM, dep_c[0], res_c[0]));
+  reductions[0].coef = coef_;
+  if (cv_key_ != "") {
+    reductions[0].multiplier = (*S->GetFieldData(cv_key_)->ViewComponent("cell", false))[0];
+    reductions[0].surface_divisor = (*S->GetFieldData(surf_cv_key_)->ViewComponent("cell", false))[0];
+  }
+  if (molar_dens_key_ != "") {
+    reductions[0].divisor = (*S->GetFieldData(molar_dens_key_)->ViewComponent("cell",false))[0];
   }
+  columns_->Evaluate(reductions);
 }
 
 
@@ -45,6 +45,7 @@ of summing fluxes onto the surface and converting to m/s instead of mol/m^2/s).
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "ColumnReductions.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -78,6 +79,9 @@ protected:
   Key domain_;
   Key surf_domain_;
 
+  // column structure, cached on first evaluation
+  Teuchos::RCP<ColumnReductions> columns_;
+
   bool updated_once_;
 private:
   static Utils::RegisteredFactory<FieldEvaluator,ColumnSumEvaluator> factory_;
@@ -0,0 +1,364 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Writes visualization and checkpoint files on a background thread.
+
+#include <chrono>
+#include <set>
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "errors.hh"
+#include "State.hh"
+#include "Visualization.hh"
+#include "Checkpoint.hh"
+
+#include "ats_mesh_factory.hh"
+#include "async_output_writer.hh"
+
+namespace ATS {
+
+namespace {
+
+// The entry of the "mesh" list from which the mesh of domain is built, or
+// the empty string if there is none.
+std::string meshListEntry(const Teuchos::ParameterList& mesh_list, std::string domain)
+{
+  if (domain.empty()) domain = "domain";
+  if (mesh_list.isSublist(domain)) return domain;
+
+  std::string delim(1, Amanzi::Keys::dset_delimiter);
+  if (Amanzi::Keys::isDomainSet(domain)) {
+    std::string ds_entry = Amanzi::Keys::getDomainSetName(domain) + delim + "*";
+    if (mesh_list.isSublist(ds_entry)) return ds_entry;
+  }
+  if (Amanzi::Keys::ends_with(domain, "_3d"))
+    return meshListEntry(mesh_list, domain.substr(0, domain.size()-3));
+  return "";
+}
+
+
+// Adds to entries the entries of the "mesh" list that the meshes of list are
+// built from, recursively.
+void addParentEntries(const Teuchos::ParameterList& mesh_list, const Teuchos::ParameterList& list,
+                      std::set<std::string>& entries)
+{
+  for (auto& p : list) {
+    const std::string& name = p.first;
+    if (list.isSublist(name)) {
+      addParentEntries(mesh_list, list.sublist(name), entries);
+    } else if (list.isType<std::string>(name) &&
+               (name == "parent domain" || name == "indexing parent domain" ||
+                name == "referencing parent domain" || name == "alias")) {
+      std::string entry = meshListEntry(mesh_list, list.get<std::string>(name));
+      if (!entry.empty() && entries.insert(entry).second)
+        addParentEntries(mesh_list, mesh_list.sublist(entry), entries);
+    }
+  }
+}
+
+} // namespace
+
+
+AsyncOutputWriter::AsyncOutputWriter(Teuchos::ParameterList& plist,
+        const Amanzi::State& S, const Amanzi::Comm_ptr_type& comm, int queue_depth) :
+    busy_(false),
+    done_(false),
+    num_writes_(0),
+    num_stalls_(0),
+    stall_time_(0.)
+{
+  if (queue_depth < 1) {
+    Errors::Message msg("AsyncOutputWriter: \"asynchronous output queue depth\" must be at least 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // the fields that may be written, and the domains they are on
+  std::set<std::string> domains;
+  domains.insert("domain");
+  for (Amanzi::State::field_iterator field=S.field_begin(); field!=S.field_end(); ++field) {
+    const Amanzi::Key& key = field->first;
+    bool vis = field->second->io_vis();
+    bool chkp = field->second->io_checkpoint();
+    if (!vis && !chkp) continue;
+
+    switch (field->second->type()) {
+      case Amanzi::COMPOSITE_VECTOR_FIELD:
+        for (const auto& comp : *S.GetFieldData(key)) staged_.push_back({ key, comp, vis, chkp });
+        domains.insert(Amanzi::Keys::getDomain(key));
+        break;
+      case Amanzi::CONSTANT_VECTOR:
+        staged_.push_back({ key, "", vis, chkp });
+        break;
+      case Amanzi::CONSTANT_SCALAR:
+        staged_scalars_.push_back(key);
+        break;
+      default:
+        break;
+    }
+  }
+  if (plist.isSublist("visualization")) {
+    for (auto& entry : plist.sublist("visualization")) domains.insert(entry.first);
+  }
+
+  // The writer's collectives go through its own communicator, and so through
+  // its own copy of the meshes that are written.
+  auto mpi_comm = Teuchos::rcp_dynamic_cast<const Amanzi::MpiComm_type>(comm);
+  if (mpi_comm == Teuchos::null) {
+    Errors::Message msg("AsyncOutputWriter: requires an MPI communicator.");
+    Exceptions::amanzi_throw(msg);
+  }
+  MPI_Comm_dup(mpi_comm->Comm(), &mpi_comm_);
+  comm_ = Teuchos::rcp(new Amanzi::MpiComm_type(mpi_comm_));
+
+  Teuchos::ParameterList& mesh_list = plist.sublist("mesh");
+  std::set<std::string> entries;
+  for (const auto& domain : domains) {
+    std::string entry = meshListEntry(mesh_list, domain);
+    if (!entry.empty() && entries.insert(entry).second)
+      addParentEntries(mesh_list, mesh_list.sublist(entry), entries);
+  }
+
+  // the input, with only the meshes needed
+  Teuchos::ParameterList out_plist(plist);
+  Teuchos::ParameterList& out_mesh_list = out_plist.sublist("mesh");
+  for (auto& entry : mesh_list) {
+    if (mesh_list.isSublist(entry.first) && !entries.count(entry.first))
+      out_mesh_list.remove(entry.first);
+  }
+
+  Teuchos::ParameterList region_list = plist.sublist("regions");
+  auto gm = Teuchos::rcp(new Amanzi::AmanziGeometry::GeometricModel(3, region_list, *comm_));
+  Teuchos::ParameterList state_list = plist.sublist("state");
+  S_meshes_ = Teuchos::rcp(new Amanzi::State(state_list));
+  ATS::Mesh::createMeshes(out_plist, comm_, gm, *S_meshes_);
+
+  // The State written from, whose written fields are overwritten from a
+  // staging buffer before each write.
+  S_out_ = Teuchos::rcp(new Amanzi::State(S));
+  *S_out_ = S;
+
+  // allocate the staging buffers up front, so that staging is only a copy
+  for (int i=0; i!=queue_depth; ++i) {
+    auto staging = Teuchos::rcp(new Staging());
+    for (const auto& sv : staged_) {
+      if (sv.component.empty()) {
+        staging->vectors.emplace_back(Teuchos::rcp(new Epetra_MultiVector(*S.GetConstantVectorData(sv.key))));
+      } else {
+        staging->vectors.emplace_back(Teuchos::rcp(new Epetra_MultiVector(
+                *S.GetFieldData(sv.key)->ViewComponent(sv.component, false))));
+      }
+    }
+    staging->scalars.resize(staged_scalars_.size());
+    staging_free_.emplace_back(staging);
+  }
+}
+
+
+AsyncOutputWriter::~AsyncOutputWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    done_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) thread_.join();
+
+  // everything on the duplicate communicator goes before it is freed
+  vis_.clear();
+  chkp_ = Teuchos::null;
+  S_out_ = Teuchos::null;
+  S_meshes_ = Teuchos::null;
+  comm_ = Teuchos::null;
+  MPI_Comm_free(&mpi_comm_);
+}
+
+
+bool AsyncOutputWriter::IsSupported(const Amanzi::State& S)
+{
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided < MPI_THREAD_MULTIPLE) return false;
+
+  for (Amanzi::State::mesh_iterator mesh=S.mesh_begin(); mesh!=S.mesh_end(); ++mesh) {
+    if (S.IsDeformableMesh(mesh->first)) return false;
+  }
+  return true;
+}
+
+
+void AsyncOutputWriter::Start(const std::vector<Teuchos::RCP<Amanzi::Visualization> >& vis,
+                              const Teuchos::RCP<Amanzi::Checkpoint>& chkp)
+{
+  vis_ = vis;
+  chkp_ = chkp;
+  thread_ = std::thread(&AsyncOutputWriter::Run_, this);
+}
+
+
+void AsyncOutputWriter::Enqueue(const Amanzi::State& S, const std::vector<int>& vis,
+                                bool chkp, double dt)
+{
+  if (vis.size() == 0 && !chkp) return;
+
+  Job job;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    RethrowIfFailed_();
+    if (staging_free_.size() == 0) {
+      // back-pressure: the writer has fallen behind, wait for a free buffer
+      auto start = std::chrono::steady_clock::now();
+      cv_.wait(lock, [this]() { return staging_free_.size() > 0 || error_; });
+      RethrowIfFailed_();
+      stall_time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      num_stalls_++;
+    }
+    job.staging = staging_free_.back();
+    staging_free_.pop_back();
+  }
+
+  // the copy into the staging buffer is the only part on the critical path
+  job.vis = vis;
+  job.chkp = chkp;
+  job.dt = dt;
+  Stage_(S, job);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.emplace_back(std::move(job));
+  }
+  cv_.notify_all();
+}
+
+
+void AsyncOutputWriter::Flush()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return (queue_.size() == 0 && !busy_) || error_; });
+  RethrowIfFailed_();
+}
+
+
+void AsyncOutputWriter::Drain() noexcept
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return queue_.size() == 0 && !busy_; });
+  error_ = nullptr;
+}
+
+
+void AsyncOutputWriter::WriteNow(const Amanzi::State& S, const std::vector<int>& vis,
+                                 bool chkp, double dt)
+{
+  Drain();
+  for (int i : vis) WriteVis(*vis_[i], S);
+  if (chkp) chkp_->Write(S, dt);
+}
+
+
+void AsyncOutputWriter::Run_()
+{
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return queue_.size() > 0 || done_; });
+      if (queue_.size() == 0) return; // done and drained
+      job = std::move(queue_.front());
+      queue_.pop_front();
+      busy_ = true;
+    }
+
+    // after a failure, remaining jobs are dropped
+    bool failed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      failed = static_cast<bool>(error_);
+    }
+    if (!failed) {
+      try {
+        Unstage_(job);
+        for (int i : job.vis) WriteVis(*vis_[i], *S_out_);
+        if (job.chkp) chkp_->Write(*S_out_, job.dt);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = std::current_exception();
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      staging_free_.push_back(job.staging);
+      busy_ = false;
+      num_writes_++;
+    }
+    cv_.notify_all();
+  }
+}
+
+
+// Copies the fields of S written by job into its staging buffer.
+void AsyncOutputWriter::Stage_(const Amanzi::State& S, Job& job) const
+{
+  Staging& staging = *job.staging;
+  staging.time = S.time();
+  staging.cycle = S.cycle();
+
+  bool vis = job.vis.size() > 0;
+  for (int i=0; i!=staged_.size(); ++i) {
+    const auto& sv = staged_[i];
+    if (!((vis && sv.vis) || (job.chkp && sv.chkp))) continue;
+    if (sv.component.empty()) {
+      *staging.vectors[i] = *S.GetConstantVectorData(sv.key);
+    } else {
+      *staging.vectors[i] = *S.GetFieldData(sv.key)->ViewComponent(sv.component, false);
+    }
+  }
+  for (int i=0; i!=staged_scalars_.size(); ++i) {
+    staging.scalars[i] = *S.GetScalarData(staged_scalars_[i]);
+  }
+}
+
+
+// Copies the staging buffer of job into the State written from.
+void AsyncOutputWriter::Unstage_(const Job& job)
+{
+  const Staging& staging = *job.staging;
+  S_out_->set_time(staging.time);
+  S_out_->set_cycle(staging.cycle);
+
+  bool vis = job.vis.size() > 0;
+  for (int i=0; i!=staged_.size(); ++i) {
+    const auto& sv = staged_[i];
+    if (!((vis && sv.vis) || (job.chkp && sv.chkp))) continue;
+    Amanzi::Key owner = S_out_->GetField(sv.key)->owner();
+    if (sv.component.empty()) {
+      Epetra_MultiVector& vec = *S_out_->GetConstantVectorData(sv.key, owner);
+      vec = *staging.vectors[i];
+    } else {
+      *S_out_->GetFieldData(sv.key, owner)->ViewComponent(sv.component, false) = *staging.vectors[i];
+    }
+  }
+  for (int i=0; i!=staged_scalars_.size(); ++i) {
+    const auto& key = staged_scalars_[i];
+    *S_out_->GetScalarData(key, S_out_->GetField(key)->owner()) = staging.scalars[i];
+  }
+}
+
+
+// must be called with mutex_ held
+void AsyncOutputWriter::RethrowIfFailed_()
+{
+  if (error_) {
+    std::exception_ptr err = error_;
+    error_ = nullptr;
+    std::rethrow_exception(err);
+  }
+}
+
+} // namespace ATS
@@ -0,0 +1,165 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Writes visualization and checkpoint files on a background thread.
+
+/*!
+
+Visualization and checkpoint dumps are, by default, written synchronously
+inside the timestep loop, stalling the solver on HDF5 I/O.  When
+`"asynchronous output`" is enabled in the `"cycle driver`" list, the
+Coordinator instead copies the fields to be written (those visualized or
+checkpointed) into one of a small pool of staging buffers and hands that copy
+to a writer thread, which then writes all requested files while the next step
+advances.  Visualization and checkpoint files due in the same cycle share one
+copy.
+
+The pool size sets the depth of the queue.  If all staging buffers are in use
+(the writer has fallen behind), the timestep loop blocks until one is freed;
+these stalls are counted and reported at the end of the run.
+
+Writes are MPI-collective, and are made from the writer thread concurrently
+with solver communication.  Collectives on one communicator may not be
+concurrent, so the writer's Visualization and Checkpoint objects are built on
+a duplicate of the solver's communicator.  As these take their communicator
+from their mesh, each mesh that is written is also built on the duplicate
+communicator, along with any mesh it is built from; meshes that are not
+written are not duplicated.
+
+This requires an MPI library providing MPI_THREAD_MULTIPLE, which is only
+requested at startup when asynchronous output is enabled.  If it is not
+provided, or if any mesh is deformable (and so could move while being
+written), output falls back to synchronous writes.
+
+*/
+
+#ifndef ATS_ASYNC_OUTPUT_WRITER_HH_
+#define ATS_ASYNC_OUTPUT_WRITER_HH_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mpi.h"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "Epetra_MultiVector.h"
+
+#include "AmanziTypes.hh"
+#include "Key.hh"
+
+namespace Amanzi {
+class State;
+class Visualization;
+class Checkpoint;
+};
+
+namespace ATS {
+
+class AsyncOutputWriter {
+ public:
+  // Duplicates comm and creates on it the meshes of plist that are written.
+  AsyncOutputWriter(Teuchos::ParameterList& plist, const Amanzi::State& S,
+                    const Amanzi::Comm_ptr_type& comm, int queue_depth);
+  ~AsyncOutputWriter();
+
+  // Meshes, on the writer's communicator, on which to build its output.
+  Amanzi::State& meshes() { return *S_meshes_; }
+
+  // Sets the output objects, which must be built on meshes(), and starts the
+  // writer thread.
+  void Start(const std::vector<Teuchos::RCP<Amanzi::Visualization> >& vis,
+             const Teuchos::RCP<Amanzi::Checkpoint>& chkp);
+
+  // Copies the fields of S to be written into a staging buffer, blocking if
+  // none are free, and queues writes of the visualization objects indexed by
+  // vis and, if requested, a checkpoint.
+  void Enqueue(const Amanzi::State& S, const std::vector<int>& vis, bool chkp, double dt);
+
+  // Blocks until all queued writes are complete, rethrowing any error from
+  // the writer.
+  void Flush();
+
+  // Blocks until all queued writes are complete, dropping any error from the
+  // writer.  Safe to call while handling an exception.
+  void Drain() noexcept;
+
+  // Drains the queue, then writes S on the calling thread.  For writes that
+  // must not be deferred, e.g. after a failure.
+  void WriteNow(const Amanzi::State& S, const std::vector<int>& vis, bool chkp, double dt);
+
+  // Can output be written asynchronously for this State and MPI library?
+  static bool IsSupported(const Amanzi::State& S);
+
+  int num_writes() const { return num_writes_; }
+  int num_stalls() const { return num_stalls_; }
+  double stall_time() const { return stall_time_; }
+
+ private:
+  // copies of the written fields of a State
+  struct Staging {
+    double time;
+    int cycle;
+    std::vector<Teuchos::RCP<Epetra_MultiVector> > vectors; // one per component of staged_
+    std::vector<double> scalars;                             // one per staged_scalars_
+  };
+
+  struct Job {
+    Teuchos::RCP<Staging> staging;
+    std::vector<int> vis;
+    bool chkp;
+    double dt;
+  };
+
+  // a vector-valued field, or a component of one, that may be written
+  struct StagedVector {
+    Amanzi::Key key;
+    std::string component; // empty for constant vectors
+    bool vis;
+    bool chkp;
+  };
+
+  void Stage_(const Amanzi::State& S, Job& job) const;
+  void Unstage_(const Job& job);
+  void Run_();
+  void RethrowIfFailed_();
+
+ private:
+  MPI_Comm mpi_comm_;
+  Amanzi::Comm_ptr_type comm_;
+  Teuchos::RCP<Amanzi::State> S_meshes_;
+
+  std::vector<Teuchos::RCP<Amanzi::Visualization> > vis_;
+  Teuchos::RCP<Amanzi::Checkpoint> chkp_;
+
+  std::vector<StagedVector> staged_;
+  std::vector<Amanzi::Key> staged_scalars_;
+  Teuchos::RCP<Amanzi::State> S_out_; // written from, by the writer thread only
+
+  std::vector<Teuchos::RCP<Staging> > staging_free_;
+  std::deque<Job> queue_;
+  bool busy_;
+  bool done_;
+  std::exception_ptr error_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+
+  int num_writes_;
+  int num_stalls_;
+  double stall_time_;
+};
+
+} // namespace ATS
+
+#endif
@@ -9,6 +9,9 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include <algorithm>
+#include <cstdlib>
+
 #include "Epetra_MpiComm.h"
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_TimeMonitor.hpp"
@@ -23,6 +26,8 @@
 #include "MeshColumn.hh"
 #include "MeshSurfaceCell.hh"
 #include "GeometricModel.hh"
+#include "startup_profiler.hh"
+#include "ColumnBatch.hh"
 
 #include "ats_mesh_factory.hh"
 
@@ -64,12 +69,14 @@ createMeshFromFile(const std::string& mesh_name,
   auto mesh = factory.create(file);
 
   if (mesh != Teuchos::null) {
-    // potentially build columns
-    if (mesh_plist.isParameter("build columns from set")) {
-      std::string regionname = mesh_plist.get<std::string>("build columns from set");
-      mesh->build_columns(regionname);
-    } else if (mesh_plist.get("build columns", false)) {
-      mesh->build_columns();
+    // potentially build columns, and renumber cells column by column
+    buildColumns(mesh_plist, *mesh);
+    if (mesh_plist.get<bool>("reorder cells by column", false)) {
+      mesh = reorderCellsByColumn(mesh, factory);
+      buildColumns(mesh_plist, *mesh);
+    }
+    if (mesh_plist.get<bool>("report column locality", false)) {
+      reportColumnLocality(*mesh, vo);
     }
 
     // verify
@@ -110,12 +117,14 @@ createMeshGenerated(const std::string& mesh_name,
   auto mesh = factory.create(mesh_generated_plist);
 
   if (mesh != Teuchos::null) {
-    // build columns
-    if (mesh_plist.isParameter("build columns from set")) {
-      std::string regionname = mesh_plist.get<std::string>("build columns from set");
-      mesh->build_columns(regionname);
-    } else if (mesh_plist.get("build columns", false)) {
-      mesh->build_columns();
+    // potentially build columns, and renumber cells column by column
+    buildColumns(mesh_plist, *mesh);
+    if (mesh_plist.get<bool>("reorder cells by column", false)) {
+      mesh = reorderCellsByColumn(mesh, factory);
+      buildColumns(mesh_plist, *mesh);
+    }
+    if (mesh_plist.get<bool>("report column locality", false)) {
+      reportColumnLocality(*mesh, vo);
     }
 
     // verify
@@ -458,6 +467,60 @@ createMeshColumnSurface(const std::string& mesh_name,
 // These might be indexed from a mesh, but have no extracting or accumulating
 // parent.
 //
+//
+// A batched domain set of columns has no meshes per entity; the set aliases
+// the columns' parent mesh (or, for column surfaces, the indexing parent),
+// whose columns share one ColumnBatch.
+void
+createDomainSetBatchedColumns(const std::string& mesh_name,
+        Teuchos::ParameterList& ds_list,
+        const std::string& indexing_parent_name,
+        State& S,
+        VerboseObject& vo)
+{
+  auto& subdomain_list = ds_list.sublist(Keys::getDomainInSet(mesh_name, "*"));
+  auto subdomain_mesh_type = subdomain_list.get<std::string>("mesh type");
+
+  std::string parent_name;
+  if (subdomain_mesh_type == "column") {
+    parent_name = subdomain_list.sublist("column parameters")
+                  .get<std::string>("parent domain", indexing_parent_name);
+    if (!S.HasMesh(parent_name)) {
+      Errors::Message msg;
+      msg << "Mesh \"" << mesh_name << "\" batched columns parent mesh \"" << parent_name
+          << "\" does not exist in State.";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    auto columns = Relations::ColumnBatch::Get(S.GetMesh(parent_name));
+    if (!columns->contiguous()) {
+      Errors::Message msg;
+      msg << "Mesh \"" << mesh_name << "\" \"batch columns\" requires the cells of each column to be"
+          << " consecutive: set \"reorder cells by column\" on mesh \"" << parent_name << "\".";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    if (vo.os_OK(Teuchos::VERB_HIGH)) {
+      *vo.os() << "  Batched domain set \"" << mesh_name << "\": " << columns->num_columns()
+               << " columns of " << columns->num_shapes() << " distinct shapes, "
+               << columns->bytes() << " bytes of topology." << std::endl;
+    }
+  } else if (subdomain_mesh_type == "column surface") {
+    parent_name = indexing_parent_name;
+  } else {
+    Errors::Message msg;
+    msg << "Mesh \"" << mesh_name << "\" \"batch columns\" requires subdomains of mesh type"
+        << " \"column\" or \"column surface\", not \"" << subdomain_mesh_type << "\".";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  S.AliasMesh(parent_name, mesh_name);
+  if (vo.os_OK(Teuchos::VERB_HIGH)) {
+    *vo.os() << "  Aliased batched domain set \"" << mesh_name << "\" to \"" << parent_name << "\"." << std::endl;
+  }
+}
+
+
 //
 // An Indexed Domain Set is a set of meshes, one per entity in an indexing mesh.
 void
@@ -484,6 +547,11 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
   std::string indexing_parent_name = ds_list.get<std::string>("indexing parent domain", "domain");
 
   if (S.HasMesh(indexing_parent_name)) {
+    if (ds_list.get<bool>("batch columns", false)) {
+      createDomainSetBatchedColumns(mesh_name, ds_list, indexing_parent_name, S, vo);
+      return;
+    }
+
     auto indexing_parent_mesh = S.GetMesh(indexing_parent_name);
 
     // is there a reference mesh for visualization?
@@ -502,6 +570,14 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
     std::vector<int> lids;
     std::map<std::string, Teuchos::RCP<const std::vector<int>>> reference_maps;
 
+    // Subdomains without their own sublist, typically all of them, share the
+    // "*" sublist.  Rather than copying it for each of (possibly hundreds of
+    // thousands of) entities, one copy is made and only its name and entity
+    // are updated for each subdomain.
+    Teuchos::RCP<Teuchos::ParameterList> shared_list;
+    bool shared_sets_gid = true;
+    bool shared_sets_lid = true;
+
     // create the subdomains, indexed over entities
     for (const auto& region : regions) {
       AmanziMesh::Entity_ID_List region_ents;
@@ -516,20 +592,33 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
         std::string full_subdomain_name = Keys::getDomainInSet(mesh_name, subdomain);
 
         // set up the parameter list
-        Teuchos::ParameterList subdomain_list;
+        Teuchos::RCP<Teuchos::ParameterList> subdomain_list;
+        bool sets_gid, sets_lid;
         if (ds_list.isSublist(full_subdomain_name)) {
-          subdomain_list = ds_list.sublist(full_subdomain_name);
+          subdomain_list = Teuchos::rcp(new Teuchos::ParameterList(ds_list.sublist(full_subdomain_name)));
+          auto& param_list = subdomain_list->sublist(subdomain_list->get<std::string>("mesh type")+" parameters");
+          sets_gid = !param_list.isParameter("entity GID");
+          sets_lid = !param_list.isParameter("entity LID");
         } else {
-          subdomain_list = ds_list.sublist(Keys::getDomainInSet(mesh_name, "*"));
+          if (shared_list == Teuchos::null) {
+            shared_list = Teuchos::rcp(new Teuchos::ParameterList(
+                ds_list.sublist(Keys::getDomainInSet(mesh_name, "*"))));
+            auto& param_list = shared_list->sublist(shared_list->get<std::string>("mesh type")+" parameters");
+            shared_sets_gid = !param_list.isParameter("entity GID");
+            shared_sets_lid = !param_list.isParameter("entity LID");
+          }
+          subdomain_list = shared_list;
+          sets_gid = shared_sets_gid;
+          sets_lid = shared_sets_lid;
         }
-        subdomain_list.setName(full_subdomain_name);
+        subdomain_list->setName(full_subdomain_name);
 
-        auto subdomain_mesh_type = subdomain_list.get<std::string>("mesh type");
-        auto& subdomain_param_list = subdomain_list.sublist(subdomain_mesh_type+" parameters");
+        auto subdomain_mesh_type = subdomain_list->get<std::string>("mesh type");
+        auto& subdomain_param_list = subdomain_list->sublist(subdomain_mesh_type+" parameters");
 
-        if (!subdomain_param_list.isParameter("entity GID"))
+        if (sets_gid)
           subdomain_param_list.set("entity GID", gid);
-        if (!subdomain_param_list.isParameter("entity LID"))
+        if (sets_lid)
           subdomain_param_list.set("entity LID", lid);
         if (!subdomain_param_list.isParameter("entity kind"))
           subdomain_param_list.set("entity kind", AmanziMesh::entity_kind_string(entity_kind));
@@ -537,7 +626,7 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
             subdomain_param_list.set("parent domain", indexing_parent_name);
 
         // construct
-        auto subdomain_mesh = createMesh(subdomain_list, indexing_parent_mesh->get_comm(), gm, S, vo);
+        auto subdomain_mesh = createMesh(*subdomain_list, indexing_parent_mesh->get_comm(), gm, S, vo);
 
         // create maps to the reference mesh
         if (is_reference_mesh) {
@@ -675,6 +764,7 @@ createMesh(Teuchos::ParameterList& mesh_plist,
 {
   auto mesh_type = mesh_plist.get<std::string>("mesh type");
   auto mesh_name = Keys::cleanPListName(mesh_plist.name());
+  StartupProfiler::Phase phase("mesh: " + StartupProfiler::Label(mesh_name));
 
   auto tab = vo.getOSTab();
   if (vo.os_OK(Teuchos::VERB_HIGH)) {
@@ -760,6 +850,116 @@ bool checkVerifyMesh(Teuchos::ParameterList& mesh_plist,
 }
 
 
+//
+// Build columns if requested.
+//
+// Collective on the mesh's comm
+void buildColumns(Teuchos::ParameterList& mesh_plist, AmanziMesh::Mesh& mesh)
+{
+  if (mesh_plist.isParameter("build columns from set")) {
+    std::string regionname = mesh_plist.get<std::string>("build columns from set");
+    mesh.build_columns(regionname);
+  } else if (mesh_plist.get("build columns", false)) {
+    mesh.build_columns();
+  }
+}
+
+
+//
+// Renumber the owned cells of a mesh column by column.  The mesh framework
+// numbers an extracted mesh in the order of the entities it is extracted
+// from, so this extracts the whole mesh from its own cells, listed column by
+// column (then any cells in no column).  Faces and nodes follow, numbered as
+// they are first reached from the cells.  The original mesh is released, so
+// entity_get_parent() is not meaningful on the result.
+//
+// Collective on the mesh's comm
+Teuchos::RCP<AmanziMesh::Mesh>
+reorderCellsByColumn(const Teuchos::RCP<AmanziMesh::Mesh>& mesh,
+                     AmanziMesh::MeshFactory& factory)
+{
+  int ncols = mesh->num_columns(false);
+  int ncols_g = 0;
+  mesh->get_comm()->SumAll(&ncols, &ncols_g, 1);
+  if (ncols_g == 0) {
+    Errors::Message msg("\"reorder cells by column\" requires \"build columns\" or \"build columns from set\".");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  int ncells = mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  std::vector<bool> placed(ncells, false);
+  AmanziMesh::Entity_ID_List cells;
+  cells.reserve(ncells);
+  for (int col=0; col!=ncols; ++col) {
+    for (auto c : mesh->cells_of_column(col)) {
+      if (c < ncells && !placed[c]) {
+        cells.push_back(c);
+        placed[c] = true;
+      }
+    }
+  }
+  for (int c=0; c!=ncells; ++c) {
+    if (!placed[c]) cells.push_back(c);
+  }
+
+  auto reordered = factory.create(mesh, cells, AmanziMesh::CELL, false, true, false);
+
+  // The copy is the mesh from here on; holding the original as its parent
+  // would double the mesh memory for no use.
+  reordered->set_parent(Teuchos::null);
+  return reordered;
+}
+
+
+//
+// Report how far the cells of each column are from being contiguous in the
+// local numbering.  Column models gather through cells_of_column(), so a
+// column split into many runs of consecutive ids, or spread over a large
+// range of ids, costs cache misses on every sweep.
+//
+// Collective on the mesh's comm
+void reportColumnLocality(const AmanziMesh::Mesh& mesh, VerboseObject& vo)
+{
+  int ncols = mesh.num_columns(false);
+  double stats[3] = { 0., 0., 0. }; // columns, runs, cells
+  int max_span = 0;
+  for (int col=0; col!=ncols; ++col) {
+    const auto& cells = mesh.cells_of_column(col);
+    if (cells.size() == 0) continue;
+
+    int runs = 1;
+    int lo = cells[0];
+    int hi = cells[0];
+    for (int i=1; i!=(int) cells.size(); ++i) {
+      if (std::abs(cells[i] - cells[i-1]) != 1) runs++;
+      lo = std::min(lo, cells[i]);
+      hi = std::max(hi, cells[i]);
+    }
+    stats[0] += 1;
+    stats[1] += runs;
+    stats[2] += cells.size();
+    max_span = std::max(max_span, hi - lo + 1);
+  }
+
+  double g_stats[3];
+  int g_max_span;
+  mesh.get_comm()->SumAll(stats, g_stats, 3);
+  mesh.get_comm()->MaxAll(&max_span, &g_max_span, 1);
+
+  if (vo.os_OK(Teuchos::VERB_LOW)) {
+    Teuchos::OSTab tab = vo.getOSTab();
+    if (g_stats[0] == 0) {
+      *vo.os() << "Column locality: mesh has no columns." << std::endl;
+    } else {
+      *vo.os() << "Column locality: " << (int) g_stats[0] << " columns, "
+               << g_stats[2] / g_stats[0] << " cells and "
+               << g_stats[1] / g_stats[0] << " contiguous runs per column on average, "
+               << "maximum local id span " << g_max_span << std::endl;
+    }
+  }
+}
+
+
 void
 createMeshes(Teuchos::ParameterList& global_list,
              const Comm_ptr_type& comm,
@@ -55,6 +55,18 @@ through providing a "verify mesh" option.
       - `"metis`" uses the METIS graph partitioner
       - `"zoltan`" uses the default Zoltan graph-based partitioner.
 
+    * `"reorder cells by column`" ``[bool]`` **false** Renumber the local
+      cells column by column, so that the cells of each column are
+      consecutive.  Column models (e.g. BGC, column diagnostics) gather field
+      values through the cells of each column, and run fastest when these
+      are.  Otherwise cells are numbered in the order of the mesh file and
+      partitioner.  Requires columns to be built.  The renumbered mesh is
+      extracted from the original, which is then released.
+
+    * `"report column locality`" ``[bool]`` **false** If columns are built,
+      report how contiguous the cells of each column are in the local
+      numbering.
+
 
 Generated Mesh
 ==============
@@ -228,6 +240,20 @@ Specified by `"mesh type`" of `"subgrid`".
     * `"flyweight mesh`" ``[bool]`` **False** NOT YET SUPPORTED.  Allows a single
       mesh instead of one per entity.
 
+Domain sets of columns, specified by `"mesh type`" of `"domain set
+indexed`", may instead be batched by setting, in the `"domain set indexed
+parameters`" list:
+
+    * `"batch columns`" ``[bool]`` **false** Build no mesh per column.  For
+      subdomains of `"mesh type`" `"column`", the set is an alias of the
+      column parent mesh, whose columns (which must be built, with `"reorder
+      cells by column`") are described once, with columns of the same number
+      of cells sharing their topology.  For `"column surface`" subdomains, the
+      set is an alias of the indexing parent (surface) mesh.  Fields and
+      evaluators of the set are then defined once, over all columns, rather
+      than once per column; the set has no per-column subdomains, so it
+      cannot be used with PKs that advance each column separately.
+
 .. todo::
    WIP: Add examples (intermediate scale model, transport subgrid model)
 
@@ -281,6 +307,12 @@ Example:
 #include "VerboseObject.hh"
 
 
+namespace Amanzi {
+namespace AmanziMesh {
+class MeshFactory;
+}
+}
+
 namespace ATS {
 namespace Mesh {
 
@@ -292,6 +324,18 @@ bool
 checkVerifyMesh(Teuchos::ParameterList& mesh_plist,
                 Teuchos::RCP<const Amanzi::AmanziMesh::Mesh> mesh);
 
+void
+buildColumns(Teuchos::ParameterList& mesh_plist,
+             Amanzi::AmanziMesh::Mesh& mesh);
+
+Teuchos::RCP<Amanzi::AmanziMesh::Mesh>
+reorderCellsByColumn(const Teuchos::RCP<Amanzi::AmanziMesh::Mesh>& mesh,
+                     Amanzi::AmanziMesh::MeshFactory& factory);
+
+void
+reportColumnLocality(const Amanzi::AmanziMesh::Mesh& mesh,
+                     Amanzi::VerboseObject& vo);
+
 //
 // Create mesh for each type
 //
@@ -13,6 +13,9 @@ including Vis and restart/checkpoint dumps.  It contains one and only one PK
 ------------------------------------------------------------------------- */
 
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <map>
 #include <unistd.h>
 #include <sys/resource.h>
 #include "errors.hh"
@@ -37,6 +40,9 @@ including Vis and restart/checkpoint dumps.  It contains one and only one PK
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
 
+#include "async_output_writer.hh"
+#include "startup_profiler.hh"
+#include "ColumnBatch.hh"
 #include "coordinator.hh"
 
 #define DEBUG_MODE 1
@@ -49,7 +55,12 @@ Coordinator::Coordinator(Teuchos::ParameterList& parameter_list,
     parameter_list_(Teuchos::rcp(new Teuchos::ParameterList(parameter_list))),
     S_(S),
     comm_(comm),
-    restart_(false) {
+    output_checkpoint_(false),
+    output_dt_(0.),
+    restart_(false),
+    commit_changed_only_(false),
+    bytes_copied_cycle_(0.),
+    bytes_copied_total_(0.) {
 
   // create and start the global timer
   timer_ = Teuchos::rcp(new Teuchos::Time("wallclock_monitor",true));
@@ -79,7 +90,10 @@ void Coordinator::coordinator_init() {
 
   // create the pk
   Amanzi::PKFactory pk_factory;
-  pk_ = pk_factory.CreatePK(pk_name, pk_tree_list, parameter_list_, S_, soln_);
+  {
+    Amanzi::StartupProfiler::Phase phase("PK construction");
+    pk_ = pk_factory.CreatePK(pk_name, pk_tree_list, parameter_list_, S_, soln_);
+  }
 
   // create the checkpointing
   Teuchos::ParameterList& chkp_plist = parameter_list_->sublist("checkpoint");
@@ -131,8 +145,14 @@ void Coordinator::setup() {
   S_->set_cycle(cycle0_);
   S_->RequireScalar("dt", "coordinator");
 
-  pk_->Setup(S_.ptr());
-  S_->Setup();
+  {
+    Amanzi::StartupProfiler::Phase phase("PK setup");
+    pk_->Setup(S_.ptr());
+  }
+  {
+    Amanzi::StartupProfiler::Phase phase("State setup");
+    S_->Setup();
+  }
 }
 
 void Coordinator::initialize() {
@@ -149,14 +169,21 @@ void Coordinator::initialize() {
   // Initialize the state
   *S_->GetScalarData("dt", "coordinator") = 0.;
   S_->GetField("dt","coordinator")->set_initialized();
-  S_->InitializeFields();
+  {
+    Amanzi::StartupProfiler::Phase phase("initialize fields");
+    S_->InitializeFields();
+  }
 
   // Initialize the process kernels
-  pk_->Initialize(S_.ptr());
+  {
+    Amanzi::StartupProfiler::Phase phase("PK initialize");
+    pk_->Initialize(S_.ptr());
+  }
 
   // Restart from checkpoint part 2:
   // -- load all other data
   if (restart_) {
+    Amanzi::StartupProfiler::Phase phase("read checkpoint");
     Amanzi::ReadCheckpoint(*S_, restart_filename_);
     t0_ = S_->time();
     cycle0_ = S_->cycle();
@@ -170,15 +197,21 @@ void Coordinator::initialize() {
   }
 
   // Final checks.
-  S_->CheckNotEvaluatedFieldsInitialized();
-  S_->InitializeEvaluators();
-  S_->InitializeFieldCopies();
-  S_->CheckAllFieldsInitialized();
+  {
+    Amanzi::StartupProfiler::Phase phase("initialize evaluators");
+    S_->CheckNotEvaluatedFieldsInitialized();
+    S_->InitializeEvaluators();
+    S_->InitializeFieldCopies();
+    S_->CheckAllFieldsInitialized();
+  }
 
 
   //WriteStateStatistics(*S_, *vo_);
   // commit the initial conditions.
-  pk_->CommitStep(0., 0., S_);
+  {
+    Amanzi::StartupProfiler::Phase phase("commit initial conditions");
+    pk_->CommitStep(0., 0., S_);
+  }
 
 
   //WriteStateStatistics(*S_, *vo_);  
@@ -192,65 +225,8 @@ void Coordinator::initialize() {
 
   
   // visualization
-  auto vis_list = Teuchos::sublist(parameter_list_,"visualization");
-  for (auto& entry : *vis_list) {
-    std::string domain_name = entry.first;
-
-    if (S_->HasMesh(domain_name)) {
-      // visualize standard domain
-      auto mesh_p = S_->GetMesh(domain_name);
-      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
-      if (!sublist_p->isParameter("file name base")) {
-        if (domain_name.empty() || domain_name == "domain") {
-          sublist_p->set<std::string>("file name base", std::string("ats_vis"));
-        } else {
-          sublist_p->set<std::string>("file name base", std::string("ats_vis_")+domain_name);
-        }
-      }
-
-      if (S_->HasMesh(domain_name+"_3d") && sublist_p->get<bool>("visualize on 3D mesh", true))
-        mesh_p = S_->GetMesh(domain_name+"_3d");
-
-      // vis successful timesteps
-      auto vis = Teuchos::rcp(new Amanzi::Visualization(*sublist_p));
-      vis->set_name(domain_name);
-      vis->set_mesh(mesh_p);
-      vis->CreateFiles(false);
-
-      visualization_.push_back(vis);
-
-    } else if (Amanzi::Keys::isDomainSet(domain_name)) {
-      // visualize domain set
-      const auto& dset = S_->GetDomainSet(Amanzi::Keys::getDomainSetName(domain_name));
-      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
-
-      if (sublist_p->get("visualize individually", false)) {
-        // visualize each subdomain
-        for (const auto& subdomain : *dset) {
-          Teuchos::ParameterList sublist = vis_list->sublist(subdomain);
-          sublist.set<std::string>("file name base", std::string("ats_vis_")+subdomain);
-          auto vis = Teuchos::rcp(new Amanzi::Visualization(sublist));
-          vis->set_name(subdomain);
-          vis->set_mesh(S_->GetMesh(subdomain));
-          vis->CreateFiles(false);
-          visualization_.push_back(vis);
-        }
-      } else {
-        // visualize collectively
-        auto domain_name_base = Amanzi::Keys::getDomainSetName(domain_name);
-        if (!sublist_p->isParameter("file name base"))
-          sublist_p->set("file name base", std::string("ats_vis_")+domain_name_base);
-        auto vis = Teuchos::rcp(new Amanzi::VisualizationDomainSet(*sublist_p));
-        vis->set_name(domain_name_base);
-        vis->set_mesh(dset->get_referencing_parent());
-        for (const auto& subdomain : *dset) {
-          vis->set_subdomain_mesh(subdomain, S_->GetMesh(subdomain));
-        }
-        vis->CreateFiles(false);
-        visualization_.push_back(vis);
-      }
-    }
-  }
+  Amanzi::StartupProfiler::Phase vis_phase("output and state copies");
+  visualization_ = create_visualization_(*S_);
 
   // make observations
   for (const auto& obs : observations_) obs->MakeObservations(S_.ptr());
@@ -294,9 +270,37 @@ void Coordinator::initialize() {
   // timestep.  This comes at the expense of an increase in memory footprint.
   pk_->set_states(Teuchos::null, S_inter_, S_next_);
 
+  // create the background writer for vis and checkpoint files
+  if (coordinator_list_->get<bool>("asynchronous output", false)) {
+    if (AsyncOutputWriter::IsSupported(*S_next_)) {
+      output_writer_ = Teuchos::rcp(new AsyncOutputWriter(*parameter_list_, *S_next_, comm_,
+              coordinator_list_->get<int>("asynchronous output queue depth", 1)));
+
+      // The writer's vis and checkpoint objects live on its meshes.  Those of
+      // the Coordinator are kept for scheduling and for synchronous writes.
+      Teuchos::ParameterList& chkp_plist = parameter_list_->sublist("checkpoint");
+      output_writer_->Start(create_visualization_(output_writer_->meshes()),
+                            Teuchos::rcp(new Amanzi::Checkpoint(chkp_plist, output_writer_->meshes())));
+    } else if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "WARNING: asynchronous output requires MPI_THREAD_MULTIPLE and no deformable meshes,"
+                 << " falling back to synchronous output." << std::endl;
+    }
+  }
 }
 
 void Coordinator::finalize() {
+  // Finish any pending writes before the final checkpoint.
+  if (output_writer_ != Teuchos::null) {
+    output_writer_->Flush();
+    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "Asynchronous output: " << output_writer_->num_writes() << " writes, "
+                 << output_writer_->num_stalls() << " stalls waiting on the writer ("
+                 << output_writer_->stall_time() << " s)" << std::endl;
+    }
+  }
+
   // Force checkpoint at the end of simulation, and copy to checkpoint_final
   pk_->CalculateDiagnostics(S_next_);
   checkpoint_->Write(*S_next_, 0.0, true);
@@ -388,10 +392,112 @@ void Coordinator::report_memory() {
              << min_doubles_count*8/1024/1024 << " MBytes" << std::endl;
   *vo_->os() << "  Total:              " << std::setw(7)
              << global_doubles_count*8/1024/1024 << " MBytes" << std::endl;
+
+  double global_bytes_copied(0.0);
+  comm_->SumAll(&bytes_copied_total_,&global_bytes_copied,1);
+  int ncycles = std::max(S_->cycle() - cycle0_, 1);
+  *vo_->os() << "State commit/rollback copies (" << (commit_changed_only_ ? "changed fields" : "full copy")
+             << ")" << std::endl;
+  *vo_->os() << "  Total:              " << std::setw(7)
+             << global_bytes_copied/1024/1024 << " MBytes" << std::endl;
+  *vo_->os() << "  Mean per cycle:     " << std::setw(7)
+             << global_bytes_copied/ncycles/1024/1024 << " MBytes" << std::endl;
+
+  // Domain sets, e.g. one subdomain per column, can dominate setup time and
+  // memory through per-subdomain meshes, fields, and evaluators.
+  double setup_time = setup_timer_->totalElapsedTime();
+  double max_setup_time(0.0);
+  comm_->MaxAll(&setup_time,&max_setup_time,1);
+  *vo_->os() << "Setup and initialization took " << max_setup_time << " s" << std::endl;
+
+  if (!parameter_list_->isSublist("mesh")) return;
+  Teuchos::ParameterList& meshes_list = parameter_list_->sublist("mesh");
+  for (auto& entry : meshes_list) {
+    std::string ds_name = entry.first;
+    if (!meshes_list.isSublist(ds_name)) continue;
+    std::string mesh_type = meshes_list.sublist(ds_name).get<std::string>("mesh type", "");
+    if (!boost::starts_with(mesh_type, "domain set")) continue;
+
+    std::string delim(1, Amanzi::Keys::dset_delimiter);
+    if (Amanzi::Keys::ends_with(ds_name, delim+"*"))
+      ds_name = ds_name.substr(0, ds_name.length()-2);
+
+    // batched sets are one (aliased) mesh, with fields defined once for all
+    // columns
+    auto& ds_list = meshes_list.sublist(entry.first);
+    if (ds_list.isSublist("domain set indexed parameters") &&
+        ds_list.sublist("domain set indexed parameters").get<bool>("batch columns", false)) {
+      if (!S_->HasMesh(ds_name)) continue;
+      auto columns = Amanzi::Relations::ColumnBatch::Get(S_->GetMesh(ds_name));
+
+      double ds_doubles_count(0.0);
+      for (Amanzi::State::field_iterator field=S_->field_begin(); field!=S_->field_end(); ++field) {
+        if (Amanzi::Keys::getDomain(field->first) == ds_name)
+          ds_doubles_count += static_cast<double>(field->second->GetLocalElementCount());
+      }
+      double local[3] = { (double) columns->num_columns(), ds_doubles_count, (double) columns->bytes() };
+      double global[3] = { 0.0, 0.0, 0.0 };
+      comm_->SumAll(local,global,3);
+      if (global[0] == 0.0) continue;
+
+      *vo_->os() << "Batched domain set \"" << ds_name << "\" has " << global[0] << " columns" << std::endl;
+      *vo_->os() << "  State fields per column:         " << std::setw(9)
+                 << global[1]*8/global[0] << " Bytes" << std::endl;
+      *vo_->os() << "  Column topology per column:      " << std::setw(9)
+                 << global[2]/global[0] << " Bytes" << std::endl;
+      continue;
+    }
+    if (!S_->HasDomainSet(ds_name)) continue;
+
+    const auto& ds = S_->GetDomainSet(ds_name);
+    double nsubdomains = std::distance(ds->begin(), ds->end());
+
+    double ds_doubles_count(0.0);
+    for (Amanzi::State::field_iterator field=S_->field_begin(); field!=S_->field_end(); ++field) {
+      Amanzi::Key domain = Amanzi::Keys::getDomain(field->first);
+      if (Amanzi::Keys::isDomainSet(domain) && Amanzi::Keys::getDomainSetName(domain) == ds_name)
+        ds_doubles_count += static_cast<double>(field->second->GetLocalElementCount());
+    }
+
+    // memory is only measured, as the change over the set's meshes and PKs,
+    // when startup is profiled
+    const auto& profiler = Amanzi::StartupProfiler::Instance();
+    double ds_mem = profiler.enabled() ? profiler.DomainSetMemory(ds_name) : 0.0;
+    double local[3] = { nsubdomains, ds_doubles_count, ds_mem };
+    double global[3] = { 0.0, 0.0, 0.0 };
+    comm_->SumAll(local,global,3);
+    if (global[0] == 0.0) continue;
+
+    *vo_->os() << "Domain set \"" << ds_name << "\" has " << global[0] << " subdomains" << std::endl;
+    *vo_->os() << "  State fields per subdomain:      " << std::setw(9)
+               << global[1]*8/global[0] << " Bytes" << std::endl;
+    if (profiler.enabled()) {
+      *vo_->os() << "  Startup memory per subdomain:    " << std::setw(9)
+                 << global[2]*1024*1024/global[0] << " Bytes" << std::endl;
+    }
+  }
 }
 
 
 
+// -----------------------------------------------------------------------------
+// write the startup profile
+// -----------------------------------------------------------------------------
+void Coordinator::report_startup_profile() {
+  std::string filename = coordinator_list_->get<std::string>("startup profile file name", "");
+  if (filename.empty()) return;
+
+  std::ofstream os;
+  if (comm_->MyPID() == 0) os.open(filename);
+  Amanzi::StartupProfiler::Instance().WriteJSON(comm_, os);
+
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "Startup profile written to \"" << filename << "\"" << std::endl;
+  }
+}
+
+
 void Coordinator::read_parameter_list() {
   Amanzi::Utils::Units units;
   t0_ = coordinator_list_->get<double>("start time");
@@ -420,6 +526,15 @@ void Coordinator::read_parameter_list() {
   duration_ = coordinator_list_->get<double>("wallclock duration [hrs]", -1.0);
   
   subcycled_ts_ = coordinator_list_->get<bool>("subcycled timestep", false); //this is only valid for subcycling intermediate-scale model
+
+  std::string commit_mode = coordinator_list_->get<std::string>("state commit mode", "full copy");
+  if (commit_mode == "changed fields") {
+    commit_changed_only_ = true;
+  } else if (commit_mode != "full copy") {
+    Errors::Message msg;
+    msg << "Coordinator: unknown \"state commit mode\" \"" << commit_mode << "\", valid are \"full copy\" and \"changed fields\"";
+    Exceptions::amanzi_throw(msg);
+  }
   // restart control
   restart_ = coordinator_list_->isParameter("restart from checkpoint file");
   if (restart_) restart_filename_ = coordinator_list_->get<std::string>("restart from checkpoint file");
@@ -474,19 +589,26 @@ bool Coordinator::advance(double t_old, double t_new) {
     for (const auto& obs : observations_) obs->MakeObservations(S_next_.ptr());
     visualize();
     checkpoint(dt);
+    write_output_();
 
     // we're done with this time step, copy the state
-    *S_ = *S_next_;
-    *S_inter_ = *S_next_;
+    std::map<Amanzi::Key, bool> changed;
+    if (commit_changed_only_) changed = changed_fields_(*S_next_);
+    const std::map<Amanzi::Key, bool>* changed_p = commit_changed_only_ ? &changed : nullptr;
+    bytes_copied_cycle_ = assign_state_(*S_, *S_next_, changed_p);
+    if (S_inter_ != S_) bytes_copied_cycle_ += assign_state_(*S_inter_, *S_next_, changed_p);
 
   } else {
     // Failed the timestep.
     // Potentially write out failed timestep for debugging
+    if (failed_visualization_.size() > 0 && output_writer_ != Teuchos::null) output_writer_->Flush();
     for (const auto& vis : failed_visualization_) WriteVis(*vis, *S_next_);
 
-    // The timestep sizes have been updated, so copy back old soln and try again.
-    *S_next_ = *S_;
-    *S_inter_ = *S_;
+    // The timestep sizes have been updated, so copy back old soln and try
+    // again.  The failed state is not trusted to evaluate, so everything is
+    // copied.
+    bytes_copied_cycle_ = assign_state_(*S_next_, *S_);
+    if (S_inter_ != S_) bytes_copied_cycle_ += assign_state_(*S_inter_, *S_);
 
     // check whether meshes are deformable, and if so, recover the old coordinates
     for (Amanzi::State::mesh_iterator mesh=S_->mesh_begin();
@@ -503,26 +625,206 @@ bool Coordinator::advance(double t_old, double t_new) {
         vc_vec->ScatterMasterToGhosted();
         const Epetra_MultiVector& vc = *vc_vec->ViewComponent("node", true);
 
-        std::vector<int> node_ids(vc.MyLength());
-        Amanzi::AmanziGeometry::Point_List old_positions(vc.MyLength());
+        // only nodes that moved in the failed step need to be restored
+        int dim = mesh->second.first->space_dimension();
+        Amanzi::AmanziGeometry::Point coords(dim);
+        std::vector<int> node_ids;
+        Amanzi::AmanziGeometry::Point_List old_positions;
         for (int n=0; n!=vc.MyLength(); ++n) {
-          node_ids[n] = n;
-          if (mesh->second.first->space_dimension() == 2) {
-            old_positions[n] = Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n]);
+          mesh->second.first->node_get_coordinates(n, &coords);
+          bool moved = false;
+          for (int s=0; s!=dim; ++s) moved |= coords[s] != vc[s][n];
+          if (!moved) continue;
+
+          node_ids.push_back(n);
+          if (dim == 2) {
+            old_positions.push_back(Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n]));
           } else {
-            old_positions[n] = Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n], vc[2][n]);
+            old_positions.push_back(Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n], vc[2][n]));
           }
         }
 
-        // undeform the mesh
-        Amanzi::AmanziGeometry::Point_List final_positions;
-        mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+        // undeform the mesh, unless no process has nodes to restore
+        int nmoved_l = node_ids.size();
+        int nmoved = 0;
+        mesh->second.first->get_comm()->SumAll(&nmoved_l, &nmoved, 1);
+        if (nmoved > 0) {
+          Amanzi::AmanziGeometry::Point_List final_positions;
+          mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+        }
       }
     }
   }
+
+  bytes_copied_total_ += bytes_copied_cycle_;
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "State " << (fail ? "rollback" : "commit") << " copied "
+               << bytes_copied_cycle_/1024/1024 << " MBytes" << std::endl;
+  }
   return fail;
 }
 
+
+// -----------------------------------------------------------------------------
+// Whether each field of S with an evaluator has changed since the last call,
+// as told by its evaluator.
+//
+// Each evaluator is asked, under the Coordinator's own request key, whether
+// its fields have changed, as PKs ask of their dependencies.  Evaluators whose
+// dependencies changed are updated first, so S must be a state that can be
+// evaluated, e.g. that of a successful step.  The first call finds every
+// field changed.
+// -----------------------------------------------------------------------------
+std::map<Amanzi::Key, bool> Coordinator::changed_fields_(Amanzi::State& S) {
+  // an evaluator providing several fields is asked once
+  std::map<const Amanzi::FieldEvaluator*, bool> fe_changed;
+  std::map<Amanzi::Key, bool> changed;
+  for (Amanzi::State::evaluator_iterator fe=S.field_evaluator_begin();
+       fe!=S.field_evaluator_end(); ++fe) {
+    auto it = fe_changed.find(fe->second.get());
+    if (it == fe_changed.end()) {
+      it = fe_changed.emplace(fe->second.get(),
+              fe->second->HasFieldChanged(Teuchos::ptr(&S), "coordinator commit")).first;
+    }
+    changed[fe->first] = it->second;
+  }
+  return changed;
+}
+
+
+// -----------------------------------------------------------------------------
+// Copy the data of src into dest.
+//
+// If changed is not provided, this is simply the State assignment operator.
+// Otherwise, fields that changed lists as unchanged are not copied, so that
+// fields that are constant in time (or were not touched by the step) are
+// neither read nor written.  Evaluator state (requests and
+// changed flags) is always copied, as in the assignment operator, so that
+// evaluators of dest are consistent with the data just written.
+// -----------------------------------------------------------------------------
+double Coordinator::assign_state_(Amanzi::State& dest, const Amanzi::State& src,
+        const std::map<Amanzi::Key, bool>* changed) {
+  double nbytes = 0.;
+  if (&dest == &src) return nbytes;
+
+  if (changed == nullptr) {
+    dest = src;
+    for (Amanzi::State::field_iterator field=src.field_begin(); field!=src.field_end(); ++field) {
+      nbytes += sizeof(double) * static_cast<double>(field->second->GetLocalElementCount());
+    }
+    return nbytes;
+  }
+
+  for (Amanzi::State::field_iterator field=src.field_begin(); field!=src.field_end(); ++field) {
+    const Amanzi::Key& key = field->first;
+    Teuchos::RCP<Amanzi::Field> dest_field = dest.GetField(key, dest.GetField(key)->owner());
+    if (field->second->initialized()) dest_field->set_initialized();
+    auto fe_changed = changed->find(key);
+    if (fe_changed != changed->end() && !fe_changed->second) continue;
+
+    switch (field->second->type()) {
+      case Amanzi::COMPOSITE_VECTOR_FIELD: {
+        Teuchos::RCP<const Amanzi::CompositeVector> src_cv = src.GetFieldData(key);
+        Teuchos::RCP<Amanzi::CompositeVector> dest_cv = dest.GetFieldData(key, dest_field->owner());
+        *dest_cv = *src_cv;
+        nbytes += sizeof(double) * static_cast<double>(field->second->GetLocalElementCount());
+        break;
+      }
+      case Amanzi::CONSTANT_SCALAR:
+        *dest.GetScalarData(key, dest_field->owner()) = *src.GetScalarData(key);
+        break;
+      case Amanzi::CONSTANT_VECTOR:
+        *dest.GetConstantVectorData(key, dest_field->owner()) = *src.GetConstantVectorData(key);
+        break;
+      default:
+        break;
+    }
+  }
+
+  for (Amanzi::State::evaluator_iterator fe=src.field_evaluator_begin();
+       fe!=src.field_evaluator_end(); ++fe) {
+    dest.GetFieldEvaluator(fe->first)->operator=(*fe->second);
+  }
+
+  dest.set_time(src.time());
+  dest.set_last_time(src.last_time());
+  dest.set_initial_time(src.initial_time());
+  dest.set_intermediate_time(src.intermediate_time());
+  dest.set_final_time(src.final_time());
+  dest.set_cycle(src.cycle());
+  return nbytes;
+}
+
+// -----------------------------------------------------------------------------
+// Create visualization objects for the meshes of S.
+// -----------------------------------------------------------------------------
+std::vector<Teuchos::RCP<Amanzi::Visualization> >
+Coordinator::create_visualization_(Amanzi::State& S) {
+  std::vector<Teuchos::RCP<Amanzi::Visualization> > visualization;
+  auto vis_list = Teuchos::sublist(parameter_list_,"visualization");
+  for (auto& entry : *vis_list) {
+    std::string domain_name = entry.first;
+
+    if (S.HasMesh(domain_name)) {
+      // visualize standard domain
+      auto mesh_p = S.GetMesh(domain_name);
+      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
+      if (!sublist_p->isParameter("file name base")) {
+        if (domain_name.empty() || domain_name == "domain") {
+          sublist_p->set<std::string>("file name base", std::string("ats_vis"));
+        } else {
+          sublist_p->set<std::string>("file name base", std::string("ats_vis_")+domain_name);
+        }
+      }
+
+      if (S.HasMesh(domain_name+"_3d") && sublist_p->get<bool>("visualize on 3D mesh", true))
+        mesh_p = S.GetMesh(domain_name+"_3d");
+
+      // vis successful timesteps
+      auto vis = Teuchos::rcp(new Amanzi::Visualization(*sublist_p));
+      vis->set_name(domain_name);
+      vis->set_mesh(mesh_p);
+      vis->CreateFiles(false);
+
+      visualization.push_back(vis);
+
+    } else if (Amanzi::Keys::isDomainSet(domain_name)) {
+      // visualize domain set
+      const auto& dset = S.GetDomainSet(Amanzi::Keys::getDomainSetName(domain_name));
+      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
+
+      if (sublist_p->get("visualize individually", false)) {
+        // visualize each subdomain
+        for (const auto& subdomain : *dset) {
+          Teuchos::ParameterList sublist = vis_list->sublist(subdomain);
+          sublist.set<std::string>("file name base", std::string("ats_vis_")+subdomain);
+          auto vis = Teuchos::rcp(new Amanzi::Visualization(sublist));
+          vis->set_name(subdomain);
+          vis->set_mesh(S.GetMesh(subdomain));
+          vis->CreateFiles(false);
+          visualization.push_back(vis);
+        }
+      } else {
+        // visualize collectively
+        auto domain_name_base = Amanzi::Keys::getDomainSetName(domain_name);
+        if (!sublist_p->isParameter("file name base"))
+          sublist_p->set("file name base", std::string("ats_vis_")+domain_name_base);
+        auto vis = Teuchos::rcp(new Amanzi::VisualizationDomainSet(*sublist_p));
+        vis->set_name(domain_name_base);
+        vis->set_mesh(dset->get_referencing_parent());
+        for (const auto& subdomain : *dset) {
+          vis->set_subdomain_mesh(subdomain, S.GetMesh(subdomain));
+        }
+        vis->CreateFiles(false);
+        visualization.push_back(vis);
+      }
+    }
+  }
+  return visualization;
+}
+
+
 void Coordinator::visualize(bool force) {
   // write visualization if requested
   bool dump = force;
@@ -538,19 +840,39 @@ void Coordinator::visualize(bool force) {
     pk_->CalculateDiagnostics(S_next_);
   }
 
-  for (const auto& vis : visualization_) {
-    if (force || vis->DumpRequested(S_next_->cycle(), S_next_->time())) {
-      WriteVis(*vis, *S_next_);
+  for (int i=0; i!=visualization_.size(); ++i) {
+    if (force || visualization_[i]->DumpRequested(S_next_->cycle(), S_next_->time())) {
+      if (output_writer_ != Teuchos::null) {
+        output_vis_.push_back(i);
+      } else {
+        WriteVis(*visualization_[i], *S_next_);
+      }
     }
   }
 }
 
 void Coordinator::checkpoint(double dt, bool force) {
   if (force || checkpoint_->DumpRequested(S_next_->cycle(), S_next_->time())) {
-    checkpoint_->Write(*S_next_, dt);
+    if (output_writer_ != Teuchos::null) {
+      output_checkpoint_ = true;
+      output_dt_ = dt;
+    } else {
+      checkpoint_->Write(*S_next_, dt);
+    }
   }
 }
 
+void Coordinator::write_output_(bool sync) {
+  if (output_writer_ == Teuchos::null) return;
+  if (sync) {
+    output_writer_->WriteNow(*S_next_, output_vis_, output_checkpoint_, output_dt_);
+  } else {
+    output_writer_->Enqueue(*S_next_, output_vis_, output_checkpoint_, output_dt_);
+  }
+  output_vis_.clear();
+  output_checkpoint_ = false;
+}
+
 
 // -----------------------------------------------------------------------------
 // timestep loop
@@ -562,8 +884,14 @@ void Coordinator::cycle_driver() {
   // start at time t = t0 and initialize the state.
   {
     Teuchos::TimeMonitor monitor(*setup_timer_);
-    setup();
-    initialize();
+    {
+      Amanzi::StartupProfiler::Phase phase("setup");
+      setup();
+    }
+    {
+      Amanzi::StartupProfiler::Phase phase("initialize");
+      initialize();
+    }
 
   }
 
@@ -575,6 +903,7 @@ void Coordinator::cycle_driver() {
   // visualization at IC
   visualize();
   checkpoint(dt);
+  write_output_();
 
 
 
@@ -617,9 +946,16 @@ void Coordinator::cycle_driver() {
   }
 
   catch (Amanzi::Exceptions::Amanzi_exception &e) {
+    // make sure the writer is idle before writing synchronously; its errors
+    // are dropped so as not to mask this one
+    if (output_writer_ != Teuchos::null) output_writer_->Drain();
+
     // write one more vis for help debugging
     S_next_->advance_cycle();
+    output_vis_.clear();
+    output_checkpoint_ = false;
     visualize(true); // force vis
+    write_output_(true);
 
     // flush observations to make sure they are saved
     for (const auto& obs : observations_) obs->Flush();
@@ -640,6 +976,7 @@ void Coordinator::cycle_driver() {
   WriteStateStatistics(*S_, *vo_);
   report_memory();
   Teuchos::TimeMonitor::summarize(*vo_->os());
+  report_startup_profile();
 
   finalize();
 
@@ -43,6 +43,29 @@ simulation, including starting and ending times and restart options.
       minimized.
     * `"PK tree`" ``[pk-typed-spec-list]`` List of length one, the top level
       PK_ spec.
+    * `"state commit mode`" ``[string]`` **"full copy"** One of `"full copy`"
+      or `"changed fields`".  Controls how the old and new states are
+      synchronized after a successful or failed step.  `"full copy`" deep
+      copies every field.  `"changed fields`", after a successful step, only
+      copies those fields whose evaluators recomputed them, or were told they
+      changed, during the step, which avoids rewriting constant fields
+      (permeability, porosity, cell volumes, ...) every cycle.  Fields
+      without evaluators are always copied, as is everything after a failed
+      step.  The number of bytes copied is reported per cycle at high
+      verbosity and in total at the end of the run.
+    * `"asynchronous output`" ``[bool]`` **false** If true, visualization and
+      checkpoint files are written by a background thread from a staged copy
+      of the written fields, overlapping I/O with the next step.  This
+      requires MPI_THREAD_MULTIPLE, and holds a second copy of the written
+      meshes on a duplicate communicator.  See AsyncOutputWriter.
+    * `"asynchronous output queue depth`" ``[int]`` **1** Number of staged
+      copies; the timestep loop blocks when all are waiting to be written.
+
+    * `"startup profile file name`" ``[string]`` **""** If provided, wall
+      time and memory change of each startup phase -- meshes, PK
+      construction, setup, and initialization -- are recorded and written
+      here as JSON at the end of the run.  Subdomains of a domain set are
+      aggregated.  By default startup is not profiled.
 
 Note: Either `"end cycle`" or `"end time`" are required, and if
 both are present, the simulation will stop with whichever arrives
@@ -74,6 +97,8 @@ Example:
 #ifndef ATS_COORDINATOR_HH_
 #define ATS_COORDINATOR_HH_
 
+#include <map>
+
 #include "Teuchos_Time.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -81,6 +106,7 @@ Example:
 #include "AmanziComm.hh"
 #include "AmanziTypes.hh"
 
+#include "Key.hh"
 #include "VerboseObject.hh"
 
 namespace Amanzi {
@@ -97,6 +123,8 @@ class UnstructuredObservations;
 
 namespace ATS {
 
+class AsyncOutputWriter;
+
 class Coordinator {
 
 public:
@@ -110,6 +138,7 @@ public:
   void initialize();
   void finalize();
   void report_memory();
+  void report_startup_profile();
   bool advance(double t_old, double t_new);
   void visualize(bool force=false);
   void checkpoint(double dt, bool force=false);
@@ -123,6 +152,21 @@ private:
   void coordinator_init();
   void read_parameter_list();
 
+  // Synchronizes dest with src, returning the number of bytes copied.  If
+  // changed is provided, fields it lists as unchanged are not copied.
+  double assign_state_(Amanzi::State& dest, const Amanzi::State& src,
+                       const std::map<Amanzi::Key, bool>* changed=nullptr);
+
+  // whether each field of S with an evaluator has changed since the last call
+  std::map<Amanzi::Key, bool> changed_fields_(Amanzi::State& S);
+
+  // visualization objects for the meshes of S
+  std::vector<Teuchos::RCP<Amanzi::Visualization> > create_visualization_(Amanzi::State& S);
+
+  // hands vis and checkpoint files due this cycle to the writer, in one copy
+  // of the State, or writes them now if sync
+  void write_output_(bool sync=false);
+
   // PK container and factory
   Teuchos::RCP<Amanzi::PK> pk_;
 
@@ -150,6 +194,10 @@ private:
   std::vector<Teuchos::RCP<Amanzi::Visualization> > visualization_;
   std::vector<Teuchos::RCP<Amanzi::Visualization> > failed_visualization_;
   Teuchos::RCP<Amanzi::Checkpoint> checkpoint_;
+  Teuchos::RCP<AsyncOutputWriter> output_writer_;
+  std::vector<int> output_vis_;   // indices into visualization_ due this cycle
+  bool output_checkpoint_;
+  double output_dt_;
   bool restart_;
   std::string restart_filename_;
 
@@ -162,6 +210,11 @@ private:
   Teuchos::RCP<Teuchos::Time> timer_;
   double duration_;
   bool subcycled_ts_;
+
+  // state commit/rollback control
+  bool commit_changed_only_;
+  double bytes_copied_cycle_;
+  double bytes_copied_total_;
   
   // fancy OS
   Teuchos::RCP<Amanzi::VerboseObject> vo_;
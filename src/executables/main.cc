@@ -60,6 +60,46 @@
 
 Teuchos::EVerbosityLevel Amanzi::VerbosityLevel::level_ = Teuchos::VERB_MEDIUM;
 
+
+// Does any list in plist ask for output or PKs that run on threads?
+bool
+requestsThreads(const Teuchos::ParameterList& plist)
+{
+  for (auto entry = plist.begin(); entry != plist.end(); ++entry) {
+    const std::string& name = plist.name(entry);
+    if (plist.isSublist(name)) {
+      if (requestsThreads(plist.sublist(name))) return true;
+    } else if (name == "asynchronous output" && plist.isType<bool>(name)) {
+      if (plist.get<bool>(name)) return true;
+    } else if (name == "column advance threads" && plist.isType<int>(name)) {
+      if (plist.get<int>(name) > 1) return true;
+    }
+  }
+  return false;
+}
+
+
+// MPI must be initialized with thread support before the command line is
+// parsed, so look ahead at the input file.  Parse errors are left to be
+// reported after MPI is up.
+bool
+requestsThreads(int argc, char *argv[])
+{
+  const std::string opt("--xml_file=");
+  for (int i=1; i<argc; ++i) {
+    std::string arg(argv[i]);
+    if (arg.compare(0, opt.size(), opt) == 0) {
+      try {
+        auto plist = Teuchos::getParametersFromXmlFile(arg.substr(opt.size()));
+        return requestsThreads(*plist);
+      } catch (...) {
+        return false;
+      }
+    }
+  }
+  return false;
+}
+
 int main(int argc, char *argv[])
 {
 
@@ -68,6 +108,13 @@ int main(int argc, char *argv[])
   feraiseexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
 #endif
 
+  // Request full thread support only if asynchronous output or threaded
+  // column advances are enabled, as it may slow communication in some MPI
+  // libraries.  If the library provides less, those fall back to serial.
+  if (requestsThreads(argc, argv)) {
+    int mpi_thread_provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &mpi_thread_provided);
+  }
   Teuchos::GlobalMPISession mpiSession(&argc,&argv,0);
   int rank = mpiSession.getRank();
 
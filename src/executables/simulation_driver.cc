@@ -29,6 +29,7 @@ Author: Ethan Coon (ecoon@lanl.gov)
 #include "exceptions.hh"
 
 #include "ats_mesh_factory.hh"
+#include "startup_profiler.hh"
 #include "simulation_driver.hh"
 
 
@@ -65,10 +66,18 @@ int SimulationDriver::Run(
       std::endl;
   }
 
+  // profile startup only if a profile is to be written, see Coordinator
+  if (!plist.sublist("cycle driver").get<std::string>("startup profile file name", "").empty()) {
+    Amanzi::StartupProfiler::Instance().Enable();
+  }
+
   // create the geometric model and regions
   Teuchos::ParameterList reg_params = plist.sublist("regions");
-  Teuchos::RCP<Amanzi::AmanziGeometry::GeometricModel> gm =
-    Teuchos::rcp(new Amanzi::AmanziGeometry::GeometricModel(3, reg_params, *comm) );
+  Teuchos::RCP<Amanzi::AmanziGeometry::GeometricModel> gm;
+  {
+    Amanzi::StartupProfiler::Phase phase("regions");
+    gm = Teuchos::rcp(new Amanzi::AmanziGeometry::GeometricModel(3, reg_params, *comm) );
+  }
 
   // Create the state.
   Teuchos::ParameterList state_plist = plist.sublist("state");
@@ -76,12 +85,19 @@ int SimulationDriver::Run(
 
   // create and register meshes
   //ATS::createMeshes(plist.sublist("mesh"), comm, gm, *S);
-  ATS::Mesh::createMeshes(plist, comm, gm, *S);
+  {
+    Amanzi::StartupProfiler::Phase phase("meshes");
+    ATS::Mesh::createMeshes(plist, comm, gm, *S);
+  }
 
   // create the top level Coordinator
-  ATS::Coordinator coordinator(plist, S, comm);
+  Teuchos::RCP<ATS::Coordinator> coordinator;
+  {
+    Amanzi::StartupProfiler::Phase phase("coordinator construction");
+    coordinator = Teuchos::rcp(new ATS::Coordinator(plist, S, comm));
+  }
 
   // run the simulation
-  coordinator.cycle_driver();
+  coordinator->cycle_driver();
   return 0;
 }
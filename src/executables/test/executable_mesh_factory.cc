@@ -10,7 +10,12 @@
 
 #include <UnitTest++.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "Teuchos_ParameterXMLFileReader.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
@@ -285,4 +290,81 @@ TEST_FIXTURE(Runner, CONSTRUCT_COLUMNS) {
 
 
 
+// Times a residual-like sweep over columns (a vertical second difference,
+// as in 1D diffusion), gathered through cells_of_column(), on a mesh.
+// Returns the time per sweep and the sum of the residual.
+static std::pair<double, double>
+timeColumnSweep(const AmanziMesh::Mesh& mesh, int nsweeps)
+{
+  int ncols = mesh.num_columns(false);
+  int ncells = mesh.num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+  std::vector<double> u(ncells), res(ncells, 0.);
+  for (int c=0; c!=ncells; ++c) u[c] = mesh.cell_centroid(c)[2];
+
+  auto start = std::chrono::steady_clock::now();
+  for (int n=0; n!=nsweeps; ++n) {
+    for (int col=0; col!=ncols; ++col) {
+      const auto& cells = mesh.cells_of_column(col);
+      int nz = cells.size();
+      for (int i=0; i!=nz; ++i) {
+        double up = i > 0 ? u[cells[i-1]] : u[cells[i]];
+        double dn = i < nz-1 ? u[cells[i+1]] : u[cells[i]];
+        res[cells[i]] = up - 2*u[cells[i]] + dn;
+      }
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double sum = 0.;
+  for (int c=0; c!=ncells; ++c) sum += std::abs(res[c]);
+  return std::make_pair(std::chrono::duration<double>(stop - start).count() / nsweeps, sum);
+}
+
+
+// After reordering, the cells of each column are numbered consecutively, and
+// the mesh is otherwise unchanged.  Also times a column sweep before and
+// after reordering.
+TEST_FIXTURE(Runner, REORDER_COLUMNS) {
+  setup("test/executable_mesh_construct_columns.xml");
+  go();
+  auto mesh_orig = S->GetMesh("domain");
+
+  setup("test/executable_mesh_reorder_columns.xml");
+  go();
+  auto mesh = S->GetMesh("domain");
+
+  int ncells = mesh->num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+  CHECK_EQUAL(mesh_orig->num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED), ncells);
+  CHECK_EQUAL(mesh_orig->num_columns(false), mesh->num_columns(false));
+
+  double z_orig = 0., z = 0.;
+  for (int c=0; c!=ncells; ++c) {
+    z_orig += mesh_orig->cell_centroid(c)[2];
+    z += mesh->cell_centroid(c)[2];
+  }
+  CHECK_CLOSE(z_orig, z, 1.e-8 * std::abs(z_orig));
+
+  // each column is a consecutive run of cells
+  int ncells_in_columns = 0;
+  for (int col=0; col!=mesh->num_columns(false); ++col) {
+    const auto& cells = mesh->cells_of_column(col);
+    for (int i=0; i!=(int) cells.size(); ++i) {
+      CHECK_EQUAL(cells[0] + i, cells[i]);
+    }
+    ncells_in_columns += cells.size();
+  }
+  CHECK_EQUAL(ncells, ncells_in_columns);
+
+  // same residual, in (hopefully) less time
+  int nsweeps = 200;
+  auto sweep_orig = timeColumnSweep(*mesh_orig, nsweeps);
+  auto sweep = timeColumnSweep(*mesh, nsweeps);
+  CHECK_CLOSE(sweep_orig.second, sweep.second, 1.e-8 * std::max(sweep_orig.second, 1.));
+  std::cout << "Column sweep (" << mesh->num_columns(false) << " columns): "
+            << sweep_orig.first << " s per sweep in the original numbering, "
+            << sweep.first << " s reordered by column" << std::endl;
+}
+
+
+
 }
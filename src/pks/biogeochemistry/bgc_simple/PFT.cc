@@ -149,6 +149,70 @@ void PFT::Init(Teuchos::ParameterList& plist,double col_area)
 }
 
 
+// Copy prognostic state out of State.  The order must match WriteState().
+void PFT::ReadState(const Epetra_MultiVector& state, int first, int col)
+{
+  int v = first;
+  Bleaf = state[v++][col];
+  Bleafmemory = state[v++][col];
+  Broot = state[v++][col];
+  Bstem = state[v++][col];
+  Bstore = state[v++][col];
+  GDD = state[v++][col];
+  mResp = state[v++][col];
+  gResp = state[v++][col];
+  annNPP = state[v++][col];
+  GPP = state[v++][col];
+  NPP = state[v++][col];
+  ET = state[v++][col];
+  leafstatus = (int) state[v++][col];
+  lai = state[v++][col];
+  laimemory = state[v++][col];
+  totalBiomass = state[v++][col];
+  rootD = state[v++][col];
+  bleafon = state[v++][col];
+  bleafoff = (int) state[v++][col];
+  leafondaysi = state[v++][col];
+  leafoffdaysi = state[v++][col];
+  CSinkLimit = state[v++][col];
+  maxLAI = (int) state[v++][col];
+  for (int i=0; i!=10; ++i) annCBalance[i] = state[v++][col];
+  AMANZI_ASSERT(v - first == nStateVars);
+}
+
+
+// Copy prognostic state into State.  The order must match ReadState().
+void PFT::WriteState(Epetra_MultiVector& state, int first, int col) const
+{
+  int v = first;
+  state[v++][col] = Bleaf;
+  state[v++][col] = Bleafmemory;
+  state[v++][col] = Broot;
+  state[v++][col] = Bstem;
+  state[v++][col] = Bstore;
+  state[v++][col] = GDD;
+  state[v++][col] = mResp;
+  state[v++][col] = gResp;
+  state[v++][col] = annNPP;
+  state[v++][col] = GPP;
+  state[v++][col] = NPP;
+  state[v++][col] = ET;
+  state[v++][col] = leafstatus;
+  state[v++][col] = lai;
+  state[v++][col] = laimemory;
+  state[v++][col] = totalBiomass;
+  state[v++][col] = rootD;
+  state[v++][col] = bleafon;
+  state[v++][col] = bleafoff;
+  state[v++][col] = leafondaysi;
+  state[v++][col] = leafoffdaysi;
+  state[v++][col] = CSinkLimit;
+  state[v++][col] = maxLAI;
+  for (int i=0; i!=10; ++i) state[v++][col] = annCBalance[i];
+  AMANZI_ASSERT(v - first == nStateVars);
+}
+
+
 // Initialize the root distribution
 void PFT::InitRoots(const Epetra_SerialDenseVector& SoilTArr,
                     const Epetra_SerialDenseVector& SoilDArr,
@@ -37,6 +37,7 @@ Paramters for a plant functional type.
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Epetra_SerialDenseVector.h"
+#include "Epetra_MultiVector.h"
 
 #include "dbc.hh"
 
@@ -64,6 +65,13 @@ class PFT {
                  const Epetra_SerialDenseVector& SoilDArr,
                  const Epetra_SerialDenseVector& SoilThicknessArr);
 
+  // The prognostic state, i.e. the members that BGCAdvance() changes from
+  // step to step, less BRootSoil.  This is stored in State as nStateVars
+  // vectors per PFT, starting at vector first, and indexed by column.
+  static const int nStateVars = 33;
+  void ReadState(const Epetra_MultiVector& state, int first, int col);
+  void WriteState(Epetra_MultiVector& state, int first, int col) const;
+
   bool AssertRootBalance_or_die() {
     double totalRootW = BRootSoil.Norm1();
     AMANZI_ASSERT(std::abs(totalRootW - Broot) < 1.e-6);
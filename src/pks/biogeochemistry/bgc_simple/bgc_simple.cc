@@ -54,6 +54,10 @@ BGCSimple::BGCSimple(Teuchos::ParameterList& pk_tree,
   Teuchos::ParameterList& lai_sublist =
       FElist.sublist(total_lai_key_);
   lai_sublist.set("field evaluator type", "primary variable");
+
+  // -- PFT state, stored in State so that it is checkpointed and rolled back
+  pft_state_key_ = Keys::readKey(*plist_, domain_surf_, "pft state", "pft_state");
+  pft_root_key_ = Keys::readKey(*plist_, domain_, "pft root biomass", "pft_root_biomass");
 }
 
 // is a PK
@@ -73,8 +77,8 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
   // -- SoilCarbonParameters
   Teuchos::ParameterList& sc_params = plist_->sublist("soil carbon parameters");
   std::string mesh_part_name = sc_params.get<std::string>("mesh partition");
-  const Functions::MeshPartition& mp = *S->GetMeshPartition(mesh_part_name);
-  const std::vector<std::string>& regions = mp.regions();
+  sc_partition_ = S->GetMeshPartition(mesh_part_name);
+  const std::vector<std::string>& regions = sc_partition_->regions();
 
   for (std::vector<std::string>::const_iterator region=regions.begin();
        region!=regions.end(); ++region) {
@@ -82,58 +86,62 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
         new SoilCarbonParameters(nPools, sc_params.sublist(*region))));
   }
 
-  // -- PFTs -- old and new!
-  Teuchos::ParameterList& pft_params = plist_->sublist("pft parameters");
-  std::vector<std::string> pft_names;
-  for (Teuchos::ParameterList::ConstIterator lcv=pft_params.begin();
-       lcv!=pft_params.end(); ++lcv) {
-    std::string pft_name = lcv->first;
-    pft_names.push_back(pft_name);
-  }
-
+  // -- cache the cells of each column
   int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  pfts_old_.resize(ncols);
-  pfts_.resize(ncols);
   for (unsigned int col=0; col!=ncols; ++col) {
     int f = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
     ColIterator col_iter(*mesh_, f);
     std::size_t ncol_cells = col_iter.size();
 
-    // unclear which this should be:
-    // -- col area is the true face area
-    double col_area = mesh_->face_area(f);
-    // -- col area is the projected face area
-    // double col_area = mesh_surf_->cell_volume(col);
-
     if (ncells_per_col_ < 0) {
       ncells_per_col_ = ncol_cells;
+      col_cells_.reserve(ncols * ncells_per_col_);
     } else {
       AMANZI_ASSERT(ncol_cells == ncells_per_col_);
     }
-
-    pfts_old_[col].resize(pft_names.size());
-    pfts_[col].resize(pft_names.size());
-
-    for (int i=0; i!=pft_names.size(); ++i) {
-      std::string pft_name = pft_names[i];
-      Teuchos::ParameterList& pft_plist = pft_params.sublist(pft_name);
-      pfts_old_[col][i] = Teuchos::rcp(new PFT(pft_name, ncol_cells));
-      pfts_old_[col][i]->Init(pft_plist,col_area);
-      pfts_[col][i] = Teuchos::rcp(new PFT(*pfts_old_[col][i]));
+    col_cells_.insert(col_cells_.end(), col_iter.begin(), col_iter.end());
+  }
+  if (ncells_per_col_ < 0) ncells_per_col_ = 0; // no columns on this process
+
+  // -- workspaces, one per thread
+  int nthreads = plist_->get<int>("column advance threads", 1);
+  if (nthreads > 1) {
+    if (!ColumnThreadPool::IsSupported()) {
+      Errors::Message msg;
+      msg << "BGCSimple \"" << name_ << "\": \"column advance threads\" requires Trilinos built with Teuchos_ENABLE_THREAD_SAFE and MPI providing MPI_THREAD_MULTIPLE.";
+      Exceptions::amanzi_throw(msg);
     }
+    thread_pool_ = Teuchos::rcp(new ColumnThreadPool(nthreads));
+  } else {
+    nthreads = 1;
   }
+  column_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": column advance");
 
-  // -- soil carbon pools
-  soil_carbon_pools_.resize(ncols);
-  for (unsigned int col=0; col!=ncols; ++col) {
-    soil_carbon_pools_[col].resize(ncells_per_col_);
-    ColIterator col_iter(*mesh_, mesh_surf_->entity_get_parent(AmanziMesh::CELL, col), ncells_per_col_);
+  Teuchos::ParameterList& pft_params = plist_->sublist("pft parameters");
+  for (int t=0; t!=nthreads; ++t) {
+    auto ws = Teuchos::rcp(new ColumnWorkspace_(ncells_per_col_));
+
+    // -- PFTs.  Parameters are the same on all columns, state is loaded from
+    //    State.
+    for (Teuchos::ParameterList::ConstIterator lcv=pft_params.begin();
+         lcv!=pft_params.end(); ++lcv) {
+      std::string pft_name = lcv->first;
+      auto pft = Teuchos::rcp(new PFT(pft_name, ncells_per_col_));
+      pft->Init(pft_params.sublist(pft_name), 1.0);
+      ws->pfts.push_back(pft);
+    }
 
-    for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      // col_iter[i] = cell id, mp[cell_id] = index into partition list, sc_params_[index] = correct params
-      soil_carbon_pools_[col][i] = Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_iter[i]]]));
+    // -- soil carbon pools, viewing a contiguous array.  Parameters are set
+    //    for each cell as it is loaded.
+    ws->soil_carbon.resize(ncells_per_col_ * nPools, 0.);
+    ws->soil_carbon_pools.resize(ncells_per_col_);
+    for (int i=0; i!=ncells_per_col_; ++i) {
+      ws->soil_carbon_pools[i] = Teuchos::rcp(new SoilCarbon(sc_params_[0], &ws->soil_carbon[i*nPools]));
     }
+    workspaces_.push_back(ws);
   }
+  std::vector<std::string> pft_names;
+  for (const auto& pft : workspaces_[0]->pfts) pft_names.push_back(pft->pft_type);
 
   // requirements: primary variable
   S->RequireField(key_, name_)->SetMesh(mesh_)
@@ -184,6 +192,12 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
   S->RequireField("surface-veg_total_transpiration", name_)->SetMesh(mesh_surf_)
       ->SetComponent("cell", AmanziMesh::CELL, pft_names.size());
 
+  // requirement: PFT state
+  S->RequireField(pft_state_key_, name_)->SetMesh(mesh_surf_)
+      ->SetComponent("cell", AmanziMesh::CELL, pft_names.size() * PFT::nStateVars);
+  S->RequireField(pft_root_key_, name_)->SetMesh(mesh_)
+      ->SetComponent("cell", AmanziMesh::CELL, pft_names.size());
+
   // requirement: temp of each cell
   S->RequireFieldEvaluator("temperature");
   S->RequireField("temperature")->SetMesh(mesh_)->AddComponent("cell", AmanziMesh::CELL, 1);
@@ -229,6 +243,9 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
 void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
   PK_Physical_Default::Initialize(S);
 
+  // column depths and thicknesses
+  UpdateColumnGeometry_();
+
   // diagnostic variable
   S->GetFieldData("co2_decomposition", name_)->PutScalar(0.);
   S->GetField("co2_decomposition", name_)->set_initialized();
@@ -256,30 +273,22 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
       Teuchos::rcp_dynamic_cast<Field_CompositeVector>(leaf_biomass_field);
   AMANZI_ASSERT(leaf_biomass_field_cv != Teuchos::null);
 
-  int npft = pfts_old_[0].size();
+  std::vector<Teuchos::RCP<PFT> >& pfts = workspaces_[0]->pfts;
+  int npft = pfts.size();
   std::vector<std::vector<std::string> > names;
   names.resize(1);
   names[0].resize(npft);
-  for (int i=0; i!=npft; ++i) names[0][i] = pfts_old_[0][i]->pft_type;
+  for (int i=0; i!=npft; ++i) names[0][i] = pfts[i]->pft_type;
   leaf_biomass_field_cv->set_subfield_names(names);
 
+  bool leaf_biomass_ic = false;
   if (!leaf_biomass_field->initialized()) {
     // -- Calculate the IC.
     if (plist_->isSublist("leaf biomass initial condition")) {
       Teuchos::ParameterList ic_plist = plist_->sublist("leaf biomass initial condition");
       leaf_biomass_field->Initialize(ic_plist);
-
-      // -- copy into PFTs
-      Epetra_MultiVector& bio = *S->GetFieldData("surface-leaf_biomass", name_)
-          ->ViewComponent("cell", false);
-      
-      int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-      for (int col=0; col!=ncols; ++col) {
-        for (int i=0; i!=npft; ++i) {
-          pfts_old_[col][i]->Bleaf = bio[i][col];
-        }
-      }
       leaf_biomass_field->set_initialized();
+      leaf_biomass_ic = true;
     }
     
     if (!leaf_biomass_field->initialized()) {
@@ -287,52 +296,62 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
       leaf_biomass_field->set_initialized();
     }
   }
-  
-  // init root carbon
-  Teuchos::RCP<Epetra_SerialDenseVector> col_temp =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> col_depth =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> col_dz =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-
-  S->GetFieldEvaluator("temperature")->HasFieldChanged(S, name_);
-  const Epetra_Vector& temp = *(*S->GetFieldData("temperature")
-				->ViewComponent("cell",false))(0);
-
-  int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  for (int col=0; col!=ncols; ++col) {
-    FieldToColumn_(col, temp, col_temp.ptr());
-    ColDepthDz_(col, col_depth.ptr(), col_dz.ptr());
 
-    for (int i=0; i!=npft; ++i) {
-      pfts_old_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
-    }
-  }
+  Teuchos::RCP<Field> pft_root_field = S->GetField(pft_root_key_, name_);
+  Teuchos::rcp_dynamic_cast<Field_CompositeVector>(pft_root_field)->set_subfield_names(names);
+  S->GetField(pft_state_key_, name_)->set_io_vis(false);
+
+  // PFT state, unless it was read from a checkpoint
+  if (!S->GetField(pft_state_key_, name_)->initialized() || !pft_root_field->initialized()) {
+    Epetra_MultiVector& pft_state = *S->GetFieldData(pft_state_key_, name_)
+        ->ViewComponent("cell", false);
+    Epetra_MultiVector& pft_root = *S->GetFieldData(pft_root_key_, name_)
+        ->ViewComponent("cell", false);
+    const Epetra_MultiVector& bio = *S->GetFieldData("surface-leaf_biomass")
+        ->ViewComponent("cell", false);
+
+    // init root carbon
+    ColumnWorkspace_& ws = *workspaces_[0];
+    S->GetFieldEvaluator("temperature")->HasFieldChanged(S, name_);
+    const Epetra_Vector& temp = *(*S->GetFieldData("temperature")
+                                  ->ViewComponent("cell",false))(0);
+
+    Teuchos::ParameterList& pft_params = plist_->sublist("pft parameters");
+    int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    for (int col=0; col!=ncols; ++col) {
+      FieldToColumn_(col, temp, Teuchos::ptr(&ws.temp));
+      for (int i=0; i!=ncells_per_col_; ++i) {
+        ws.depth[i] = col_depth_[col * ncells_per_col_ + i];
+        ws.dz[i] = col_dz_[col * ncells_per_col_ + i];
+      }
 
-  // ensure all initialization in both PFTs?  Not sure this is
-  // necessary -- likely done in initial call to commit-state --etc
-  for (int col=0; col!=ncols; ++col) {
-    for (int i=0; i!=npft; ++i) {
-      *pfts_[col][i] = *pfts_old_[col][i];
+      // unclear which this should be:
+      // -- col area is the true face area
+      double col_area = mesh_->face_area(mesh_surf_->entity_get_parent(AmanziMesh::CELL, col));
+      // -- col area is the projected face area
+      // double col_area = mesh_surf_->cell_volume(col);
+
+      const AmanziMesh::Entity_ID* cells = &col_cells_[col * ncells_per_col_];
+      for (int i=0; i!=npft; ++i) {
+        PFT& pft = *pfts[i];
+        pft.Init(pft_params.sublist(pft.pft_type), col_area);
+        if (leaf_biomass_ic) pft.Bleaf = bio[i][col];
+        pft.InitRoots(ws.temp, ws.depth, ws.dz);
+
+        pft.WriteState(pft_state, i*PFT::nStateVars, col);
+        for (int k=0; k!=ncells_per_col_; ++k) pft_root[i][cells[k]] = pft.BRootSoil[k];
+      }
     }
+    S->GetField(pft_state_key_, name_)->set_initialized();
+    pft_root_field->set_initialized();
   }
 }
 
   
 // -- Commit any secondary (dependent) variables.
 void BGCSimple::CommitStep(double told, double tnew, const Teuchos::RCP<State>& S) {
-  // Copy the PFT over, which includes all additional state required, commit
-  // the step as succesful.
-  double dt = tnew - told;
-
-  int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  int npft = pfts_old_[0].size();
-  for (int col=0; col!=ncols; ++col) {
-    for (int i=0; i!=npft; ++i) {
-      *pfts_old_[col][i] = *pfts_[col][i];
-    }
-  }
+  // All state, including that of the PFTs, is in State, and is committed
+  // there.
 }
 
 // -- advance the model
@@ -347,20 +366,18 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
                << " t1 = " << S_next_->time() << " h = " << dt << std::endl
                << "----------------------------------------------------------------" << std::endl;
 
-  // Copy the PFT from old to new, in case we failed the previous attempt at
-  // this timestep.  This is hackery to get around the fact that PFTs are not
-  // (but should be) in state.
   AmanziMesh::Entity_ID ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) {
-    int npft = pfts_old_[col].size();
-    for (int i=0; i!=npft; ++i) {
-      *pfts_[col][i] = *pfts_old_[col][i];
-    }
-  }
+  int npft = workspaces_[0]->pfts.size();
+  if (S_next_->IsDeformableMesh(domain_)) UpdateColumnGeometry_();
 
   // grab the required fields
   Epetra_MultiVector& sc_pools = *S_next_->GetFieldData(key_, name_)
       ->ViewComponent("cell",false);
+  int nPools = sc_pools.NumVectors();
+  Epetra_MultiVector& pft_state = *S_next_->GetFieldData(pft_state_key_, name_)
+      ->ViewComponent("cell",false);
+  Epetra_MultiVector& pft_root = *S_next_->GetFieldData(pft_root_key_, name_)
+      ->ViewComponent("cell",false);
   Epetra_MultiVector& co2_decomp = *S_next_->GetFieldData("co2_decomposition", name_)
       ->ViewComponent("cell",false);
   Epetra_MultiVector& trans = *S_next_->GetFieldData(trans_key_, name_)
@@ -416,40 +433,32 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
   const Epetra_MultiVector& scv = *S_inter_->GetFieldData("surface-cell_volume")
       ->ViewComponent("cell", false);
 
-  // Create workspace arrays (these should be removed when data is correctly oriented).
-  Teuchos::RCP<Epetra_SerialDenseVector> temp_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> pres_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> dz_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> depth_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
+  // Apply the model to a column.  Columns are independent: each writes only
+  // its own surface cell and the cells of its column.
+  auto advance_column = [&](int col) {
+    ColumnWorkspace_& ws = *workspaces_[thread_pool_ == Teuchos::null ? 0 : thread_pool_->ThreadIndex()];
+    const AmanziMesh::Entity_ID* cells = &col_cells_[col * ncells_per_col_];
 
-  // Create a workspace array for the result
-  Epetra_SerialDenseVector co2_decomp_c(ncells_per_col_);
-  Epetra_SerialDenseVector trans_c(ncells_per_col_);
-  double sw_c(0.);
-
-  total_lai.PutScalar(0.);
-
-  // loop over columns and apply the model
-  for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) {
     // update the various soil arrays
-    FieldToColumn_(col, *temp(0), temp_c.ptr());
-    FieldToColumn_(col, *pres(0), pres_c.ptr());
-    ColDepthDz_(col, depth_c.ptr(), dz_c.ptr());
-
-    // copy over the soil carbon arrays
-    ColIterator col_iter(*mesh_, mesh_surf_->entity_get_parent(AmanziMesh::CELL, col), ncells_per_col_);
-    // -- serious cache thrash... --etc
-    for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      AmanziGeometry::Point centroid = mesh_->cell_centroid(col_iter[i]);
-	  //      std::cout << "Col iter col=" << col << ", index i=" << i << ", cell=" << col_iter[i] << " at " << centroid << std::endl;
-      for (int p=0; p!=soil_carbon_pools_[col][i]->nPools; ++p) {
-        soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
+    for (int i=0; i!=ncells_per_col_; ++i) {
+      ws.temp[i] = temp[0][cells[i]];
+      ws.pres[i] = pres[0][cells[i]];
+      ws.depth[i] = col_depth_[col * ncells_per_col_ + i];
+      ws.dz[i] = col_dz_[col * ncells_per_col_ + i];
+    }
+
+    // load the soil carbon and PFT state of this column
+    for (int i=0; i!=ncells_per_col_; ++i) {
+      ws.soil_carbon_pools[i]->params = sc_params_[(*sc_partition_)[cells[i]]];
+      for (int p=0; p!=nPools; ++p) {
+        ws.soil_carbon[i*nPools + p] = sc_pools[p][cells[i]];
       }
     }
+    for (int lcv_pft=0; lcv_pft!=npft; ++lcv_pft) {
+      PFT& pft = *ws.pfts[lcv_pft];
+      pft.ReadState(pft_state, lcv_pft*PFT::nStateVars, col);
+      for (int i=0; i!=ncells_per_col_; ++i) pft.BRootSoil[i] = pft_root[lcv_pft][cells[i]];
+    }
 
     // Create the Met data struct
     MetData met;
@@ -460,41 +469,56 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
     met.relhum = rel_hum[0][col];
     met.CO2a = co2[0][col];
     met.lat = lat_;
-    sw_c = met.qSWin;
+    double sw_c = met.qSWin;
 
     // call the model
     BGCAdvance(S_inter_->time(), dt, scv[0][col], cryoturbation_coef_, met,
-               *temp_c, *pres_c, *depth_c, *dz_c,
-               pfts_[col], soil_carbon_pools_[col],
-               co2_decomp_c, trans_c, sw_c);
+               ws.temp, ws.pres, ws.depth, ws.dz,
+               ws.pfts, ws.soil_carbon_pools,
+               ws.co2_decomp, ws.trans, sw_c);
 
     // copy back
-    // -- serious cache thrash... --etc
-    for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      for (int p=0; p!=soil_carbon_pools_[col][i]->nPools; ++p) {
-        sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
+    for (int i=0; i!=ncells_per_col_; ++i) {
+      for (int p=0; p!=nPools; ++p) {
+        sc_pools[p][cells[i]] = ws.soil_carbon[i*nPools + p];
       }
 
       // and integrate the decomp
-      co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
-
+      co2_decomp[0][cells[i]] += ws.co2_decomp[i];
 
       // and pull in the transpiration, converting to mol/m^3/s, as a sink
-      trans[0][col_iter[i]] = trans_c[i] / .01801528;
-      sw[0][col] = sw_c;
+      trans[0][cells[i]] = ws.trans[i] / .01801528;
     }
-
-    for (int lcv_pft=0; lcv_pft!=pfts_[col].size(); ++lcv_pft) {
-      biomass[lcv_pft][col] = pfts_[col][lcv_pft]->totalBiomass;
-      leafbiomass[lcv_pft][col] = pfts_[col][lcv_pft]->Bleaf;
-      csink[lcv_pft][col] = pfts_[col][lcv_pft]->CSinkLimit;
-      lai[lcv_pft][col] = pfts_[col][lcv_pft]->lai;
-
-      total_transpiration[lcv_pft][col] = pfts_[col][lcv_pft]->ET / 0.01801528;
-      total_lai[0][col] += pfts_[col][lcv_pft]->lai;
+    sw[0][col] = sw_c;
+
+    // summed in PFT order, so the total is independent of threading
+    double total_lai_c = 0.;
+    for (int lcv_pft=0; lcv_pft!=npft; ++lcv_pft) {
+      PFT& pft = *ws.pfts[lcv_pft];
+      pft.WriteState(pft_state, lcv_pft*PFT::nStateVars, col);
+      for (int i=0; i!=ncells_per_col_; ++i) pft_root[lcv_pft][cells[i]] = pft.BRootSoil[i];
+
+      biomass[lcv_pft][col] = pft.totalBiomass;
+      leafbiomass[lcv_pft][col] = pft.Bleaf;
+      csink[lcv_pft][col] = pft.CSinkLimit;
+      lai[lcv_pft][col] = pft.lai;
+
+      total_transpiration[lcv_pft][col] = pft.ET / 0.01801528;
+      total_lai_c += pft.lai;
     }
+    total_lai[0][col] = total_lai_c;
+    return false;
+  };
 
-  } // end loop over columns
+  // loop over columns and apply the model
+  {
+    Teuchos::TimeMonitor monitor(*column_timer_);
+    if (thread_pool_ != Teuchos::null) {
+      thread_pool_->Run(ncols, advance_column, false);
+    } else {
+      for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) advance_column(col);
+    }
+  }
 
   // mark primaries as changed
   trans_eval_->SetFieldAsChanged(S_next_.ptr());
@@ -511,9 +535,25 @@ void BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& v
     col_vec = Teuchos::ptr(new Epetra_SerialDenseVector(ncells_per_col_));
   }
 
-  ColIterator col_iter(*mesh_, mesh_surf_->entity_get_parent(AmanziMesh::CELL, col), ncells_per_col_);
-  for (std::size_t i=0; i!=col_iter.size(); ++i) {
-    (*col_vec)[i] = vec[col_iter[i]];
+  const AmanziMesh::Entity_ID* cells = &col_cells_[col * ncells_per_col_];
+  for (int i=0; i!=ncells_per_col_; ++i) {
+    (*col_vec)[i] = vec[cells[i]];
+  }
+}
+
+// cache the depth and thickness of all column cells
+void BGCSimple::UpdateColumnGeometry_() {
+  int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  col_depth_.resize(ncols * ncells_per_col_);
+  col_dz_.resize(ncols * ncells_per_col_);
+
+  Epetra_SerialDenseVector depth(ncells_per_col_), dz(ncells_per_col_);
+  for (int col=0; col!=ncols; ++col) {
+    ColDepthDz_(col, Teuchos::ptr(&depth), Teuchos::ptr(&dz));
+    for (int i=0; i!=ncells_per_col_; ++i) {
+      col_depth_[col * ncells_per_col_ + i] = depth[i];
+      col_dz_[col * ncells_per_col_ + i] = dz[i];
+    }
   }
 }
 
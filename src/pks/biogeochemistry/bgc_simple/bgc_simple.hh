@@ -51,6 +51,11 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"leaf biomass initial condition`" ``[initial-conditions-spec]`` Sets the leaf biomass IC.
 
+  * `"column advance threads`" ``[int]`` **1** If greater than 1, columns are
+    advanced concurrently on this many threads, each with its own workspace.
+    Results are identical to the serial loop.  Requires Trilinos built with
+    Teuchos_ENABLE_THREAD_SAFE and MPI_THREAD_MULTIPLE, see ColumnThreadPool.
+
   * `"domain name`" ``[string]`` **domain**
 
   * `"surface domain name`" ``[string]`` **surface**
@@ -63,6 +68,14 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"total leaf area index key`" ``[string]`` **SURFACE_DOMAIN-total_leaf_area_index** Total LAI across all PFTs.
 
+  * `"pft state key`" ``[string]`` **SURFACE_DOMAIN-pft_state** The
+    prognostic state of each PFT on each column.  This is stored in State, so
+    it is checkpointed and restored on failed timesteps, but is not
+    visualized.
+
+  * `"pft root biomass key`" ``[string]`` **DOMAIN-pft_root_biomass** Root
+    biomass of each PFT in each cell `[kg C]`
+
   EVALUATORS:
 
   - `"temperature`" The soil temperature `[K]`
@@ -81,10 +94,13 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 #include "Epetra_SerialDenseVector.h"
 
 #include "VerboseObject.hh"
 #include "TreeVector.hh"
+#include "MeshPartition.hh"
+#include "column_thread_pool.hh"
 
 #include "PK_Factory.hh"
 #include "pk_physical_default.hh"
@@ -139,6 +155,7 @@ class BGCSimple : public PK_Physical_Default {
   void ColDepthDz_(AmanziMesh::Entity_ID col,
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
+  void UpdateColumnGeometry_();
 
   class ColIterator {
    public:
@@ -175,9 +192,31 @@ class BGCSimple : public PK_Physical_Default {
   
   // physical structs needed by model
   std::vector<Teuchos::RCP<SoilCarbonParameters> > sc_params_;
-  std::vector<std::vector<Teuchos::RCP<PFT> > > pfts_;       // this also contains state data!
-  std::vector<std::vector<Teuchos::RCP<PFT> > > pfts_old_;   // need two copies for failed timesteps
-  std::vector<std::vector<Teuchos::RCP<SoilCarbon> > > soil_carbon_pools_;
+  Teuchos::RCP<const Functions::MeshPartition> sc_partition_;
+
+  // Workspace for a single column.  PFT and soil carbon state is owned by
+  // State, and is loaded into these for each column in turn.  There is one
+  // workspace per thread.
+  struct ColumnWorkspace_ {
+    ColumnWorkspace_(int ncells) :
+        temp(ncells), pres(ncells), depth(ncells), dz(ncells),
+        co2_decomp(ncells), trans(ncells) {}
+
+    Epetra_SerialDenseVector temp, pres, depth, dz;
+    Epetra_SerialDenseVector co2_decomp, trans;
+    std::vector<Teuchos::RCP<PFT> > pfts;
+    std::vector<Teuchos::RCP<SoilCarbon> > soil_carbon_pools;
+    std::vector<double> soil_carbon;   // SOM of soil_carbon_pools, ordered by cell then pool
+  };
+  std::vector<Teuchos::RCP<ColumnWorkspace_> > workspaces_;
+  Teuchos::RCP<ColumnThreadPool> thread_pool_;
+  Teuchos::RCP<Teuchos::Time> column_timer_;
+
+  // cells of column col, top to bottom, are col_cells_[col*ncells_per_col_ + i],
+  // and likewise for their depth and thickness
+  std::vector<AmanziMesh::Entity_ID> col_cells_;
+  std::vector<double> col_depth_;
+  std::vector<double> col_dz_;
 
   // evaluator for transpiration
   Teuchos::RCP<PrimaryVariableFieldEvaluator> trans_eval_;
@@ -195,6 +234,8 @@ class BGCSimple : public PK_Physical_Default {
   Key trans_key_;
   Key shaded_sw_key_;
   Key total_lai_key_;
+  Key pft_state_key_;
+  Key pft_root_key_;
   
  private:
   // factory registration
@@ -0,0 +1,242 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! A thread pool for advancing independent columns concurrently.
+
+#include "mpi.h"
+#include "Teuchos_ConfigDefs.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "errors.hh"
+#include "Key.hh"
+#include "VerboseObject.hh"
+#include "column_thread_pool.hh"
+
+namespace Amanzi {
+
+namespace {
+// The pool whose task this thread is running, and its index in that pool.
+struct ThreadSlot {
+  const ColumnThreadPool* pool;
+  int index;
+};
+thread_local ThreadSlot thread_slot = { nullptr, 0 };
+
+
+// The list of PK name, or of its domain set's template, or null.
+const Teuchos::ParameterList*
+taskPKList(const Teuchos::ParameterList& pks_list, const std::string& name)
+{
+  if (pks_list.isSublist(name)) return &pks_list.sublist(name);
+
+  KeyTriple triple;
+  if (Keys::splitDomainSet(name, triple)) {
+    std::string template_name = Keys::getKey(std::get<0>(triple) + Keys::dset_delimiter + "*",
+            std::get<2>(triple));
+    if (pks_list.isSublist(template_name)) return &pks_list.sublist(template_name);
+  }
+  return nullptr;
+}
+
+
+// Does any "verbose object" list within list set a level other than "none"?
+bool
+asksForOutput(const Teuchos::ParameterList& list)
+{
+  for (auto entry = list.begin(); entry != list.end(); ++entry) {
+    const std::string& name = list.name(entry);
+    if (!list.isSublist(name)) continue;
+
+    const Teuchos::ParameterList& sublist = list.sublist(name);
+    if (name == "verbose object" || Keys::ends_with(name, " verbose object")) {
+      if (sublist.isType<std::string>("verbosity level") &&
+          sublist.get<std::string>("verbosity level") != "none") return true;
+    } else if (asksForOutput(sublist)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// Name of the first PK of name and its sub-PKs which may write output, or
+// the empty string.
+std::string
+noisyTaskPK(const Teuchos::ParameterList& pks_list, const std::string& name)
+{
+  const Teuchos::ParameterList* list = taskPKList(pks_list, name);
+  if (list == nullptr) return "";
+
+  // a PK without a level of its own uses the global default
+  bool has_level = false;
+  for (const auto& vo_name : { name + " verbose object", std::string("verbose object") }) {
+    if (list->isSublist(vo_name) &&
+        list->sublist(vo_name).isType<std::string>("verbosity level")) has_level = true;
+  }
+  if (asksForOutput(*list) ||
+      (!has_level && VerbosityLevel::level_ != Teuchos::VERB_NONE)) return name;
+
+  if (list->isType<Teuchos::Array<std::string> >("PKs order")) {
+    for (const auto& sub_pk : list->get<Teuchos::Array<std::string> >("PKs order")) {
+      std::string noisy = noisyTaskPK(pks_list, sub_pk);
+      if (!noisy.empty()) return noisy;
+    }
+  }
+  return "";
+}
+
+}
+
+
+ColumnThreadPool::ColumnThreadPool(int nthreads) :
+    task_(nullptr),
+    n_(0),
+    stop_on_fail_(true),
+    next_(0),
+    nfailed_(0),
+    nactive_(0),
+    generation_(0),
+    done_(false)
+{
+  if (nthreads < 1) {
+    Errors::Message msg("ColumnThreadPool: number of threads must be at least 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+  for (int i=1; i<nthreads; ++i) {
+    workers_.emplace_back(&ColumnThreadPool::Work_, this, i);
+  }
+}
+
+
+ColumnThreadPool::~ColumnThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    done_ = true;
+  }
+  cv_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+
+int ColumnThreadPool::ThreadIndex() const
+{
+  return thread_slot.pool == this ? thread_slot.index : 0;
+}
+
+
+bool ColumnThreadPool::IsSupported()
+{
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  int initialized;
+  MPI_Initialized(&initialized);
+  if (!initialized) return false;
+
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return false;
+#endif
+}
+
+
+void ColumnThreadPool::CheckTasks(const std::string& owner, const Teuchos::ParameterList& pks_list,
+                                  const std::vector<std::string>& task_pks)
+{
+  for (const auto& name : task_pks) {
+    std::string noisy = noisyTaskPK(pks_list, name);
+    if (!noisy.empty()) {
+      Errors::Message msg;
+      msg << owner << ": \"column advance threads\" requires PKs advanced on threads to write no output,"
+          << " but PK \"" << noisy << "\" does not set \"verbosity level\" to \"none\"."
+          << "  Output from concurrent PKs races on the shared output stream.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+
+  if (Teuchos::TimeMonitor::getStackedTimer() != Teuchos::null) {
+    Errors::Message msg;
+    msg << owner << ": \"column advance threads\" may not be used with a Teuchos stacked timer,"
+        << " which every timer in the PKs advanced on threads would share.";
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+int ColumnThreadPool::Run(int n, const std::function<bool(int)>& task, bool stop_on_fail)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    n_ = n;
+    stop_on_fail_ = stop_on_fail;
+    next_ = 0;
+    nfailed_ = 0;
+    nactive_ = workers_.size();
+    error_ = nullptr;
+    generation_++;
+  }
+  cv_.notify_all();
+
+  // the calling thread works too, as thread 0 of this pool.  It may be a
+  // worker of an enclosing pool, so its slot is restored afterwards.
+  ThreadSlot outer = thread_slot;
+  thread_slot = { this, 0 };
+  Drain_();
+  thread_slot = outer;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return nactive_ == 0; });
+  task_ = nullptr;
+  if (error_) std::rethrow_exception(error_);
+  return nfailed_;
+}
+
+
+void ColumnThreadPool::Work_(int index)
+{
+  thread_slot = { this, index };
+  unsigned long my_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&]() { return done_ || generation_ != my_generation; });
+      if (done_) return;
+      my_generation = generation_;
+    }
+
+    Drain_();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      nactive_--;
+    }
+    cv_.notify_all();
+  }
+}
+
+
+void ColumnThreadPool::Drain_()
+{
+  while (true) {
+    if (stop_on_fail_ && nfailed_ > 0) return;
+    int i = next_++;
+    if (i >= n_) return;
+
+    try {
+      if ((*task_)(i)) nfailed_++;
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+      nfailed_++;
+    }
+  }
+}
+
+} // namespace Amanzi
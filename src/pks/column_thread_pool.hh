@@ -0,0 +1,120 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! A thread pool for advancing independent columns concurrently.
+
+/*!
+
+Column PKs, constructed on COMM_SELF over their own column domains, share no
+data while advancing: each reads and writes only fields on its own domains,
+and evaluators on one column never depend on another.  This pool runs such
+independent tasks on a fixed set of threads (plus the calling thread),
+handing out tasks one at a time from a shared counter so that expensive
+columns do not hold up a statically assigned block of cheap ones.
+
+Requirements on the tasks:
+
+- A task may only modify fields on its own column domains.  Fields on shared
+  domains (e.g. the star system) must be set before, and read after, the
+  parallel region.
+- The State may not gain or lose fields or evaluators during a run.
+- Teuchos must be built thread safe (``Teuchos_ENABLE_THREAD_SAFE``), as
+  reference counts of shared objects are modified concurrently.
+- MPI must be initialized with MPI_THREAD_MULTIPLE, as column PKs make calls
+  on their own COMM_SELF communicators concurrently.  The executable requests
+  this when any list sets `"column advance threads`" greater than 1.
+
+If either of the last two is not met, IsSupported() returns false and the
+threaded option is an error.
+
+Neither Teuchos timers nor VerboseObject output are thread safe: TimeMonitor
+start/stop on shared timers (and on a stacked timer, if one is set) and
+writes through the shared output stream and its tab level race.  In threaded
+mode these are not guarded, and so must be disabled in the tasks: column PKs
+must be run with `"verbosity level`" `"none`", and may only time themselves
+on per-column timers (as MPCSubsurface does, named by PK).  Timers and output
+outside of Run() are unaffected.  CheckTasks() enforces what can be checked
+of this: that the PK lists of the tasks ask for no output, and that no
+stacked timer is set.
+
+The same pool serves column loops within a single PK (e.g. BGCSimple), where
+each task is one column and workspace is indexed by ThreadIndex().  Pools
+may be nested (e.g. a threaded BGCSimple within a threaded DomainSetMPC), so
+the index is that of the thread within the given pool, not a global one.
+
+*/
+
+#ifndef PKS_MPC_COLUMN_THREAD_POOL_HH_
+#define PKS_MPC_COLUMN_THREAD_POOL_HH_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace Amanzi {
+
+class ColumnThreadPool {
+ public:
+  // nthreads includes the calling thread, so nthreads-1 workers are created.
+  explicit ColumnThreadPool(int nthreads);
+  ~ColumnThreadPool();
+
+  // Calls task(i) for all i in [0,n), returning the number of tasks that
+  // returned true (failed).  If stop_on_fail, no new tasks are started once
+  // one has failed, consistent with the serial loops which break on the first
+  // failure.  Exceptions thrown by tasks are rethrown on the calling thread.
+  int Run(int n, const std::function<bool(int)>& task, bool stop_on_fail=true);
+
+  int size() const { return workers_.size() + 1; }
+
+  // Index, in [0,size()), of the current thread within this pool, for use
+  // in indexing per-thread workspace.  The thread calling Run() is 0, as is
+  // any thread outside of a Run() of this pool.
+  int ThreadIndex() const;
+
+  static bool IsSupported();
+
+  // Throws, naming owner, unless the PKs named by task_pks (lists in
+  // pks_list), and all of their sub-PKs, have verbosity level "none", and no
+  // stacked timer is set.
+  static void CheckTasks(const std::string& owner, const Teuchos::ParameterList& pks_list,
+                         const std::vector<std::string>& task_pks);
+
+ private:
+  void Work_(int index);
+  void Drain_();
+
+ private:
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+  // current run
+  const std::function<bool(int)>* task_;
+  int n_;
+  bool stop_on_fail_;
+  std::atomic<int> next_;
+  std::atomic<int> nfailed_;
+  int nactive_;
+  unsigned long generation_;
+  bool done_;
+  std::exception_ptr error_;
+};
+
+} // namespace Amanzi
+
+#endif
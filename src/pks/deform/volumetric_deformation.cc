@@ -450,6 +450,11 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
   }
 
 
+  // nodes of mesh_ moved by the deformation, all of them unless the strategy
+  // tracks which columns changed
+  bool all_nodes_moved = true;
+  std::vector<bool> node_moved;
+
   // only deform if needed
   double dcell_vol_norm(0.);
   dcell_vol_vec->Norm2(&dcell_vol_norm);
@@ -603,14 +608,21 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 	}
       }
 
-      // deform the mesh
-      Entity_ID_List node_ids(nodal_dz.MyLength());
-      AmanziGeometry::Point_List new_positions(nodal_dz.MyLength());
+      // deform the mesh, passing only the nodes of columns that subsided
+      all_nodes_moved = false;
+      node_moved.resize(nodal_dz.MyLength(), false);
+      Entity_ID_List node_ids;
+      AmanziGeometry::Point_List new_positions;
       for (int n=0; n!=nodal_dz.MyLength(); ++n) {
-	node_ids[n] = n;
-	mesh_->node_get_coordinates(n, &new_positions[n]);
 	AMANZI_ASSERT(nodal_dz[0][n] >= 0.);
-	new_positions[n][2] -= nodal_dz[0][n];
+	if (nodal_dz[0][n] > 0.) {
+	  AmanziGeometry::Point coords;
+	  mesh_->node_get_coordinates(n, &coords);
+	  coords[2] -= nodal_dz[0][n];
+	  node_ids.push_back(n);
+	  new_positions.push_back(coords);
+	  node_moved[n] = true;
+	}
       }
       AmanziGeometry::Point_List final_positions;
 
@@ -633,11 +645,20 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       // DEBUG CRUFT END
 #endif
       
-      mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
+      // deform is called collectively, so skip it only if no process moved nodes
+      int nmoved_l = node_ids.size();
+      int nmoved = 0;
+      mesh_->get_comm()->SumAll(&nmoved_l, &nmoved, 1);
+      if (vo_->os_OK(Teuchos::VERB_HIGH))
+        *vo_->os() << "Deforming " << nmoved << " nodes" << std::endl;
 
-      // INSERT EXTRA CODE TO UNDEFORM THE MESH FOR MIN_VOLS!
+      if (nmoved > 0) {
+        mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
 
-      solution_evaluator_->SetFieldAsChanged(S_next_.ptr());
+        // INSERT EXTRA CODE TO UNDEFORM THE MESH FOR MIN_VOLS!
+
+        solution_evaluator_->SetFieldAsChanged(S_next_.ptr());
+      }
       
 #if DEBUG
       // DEBUG CRUFT BEGIN
@@ -686,6 +707,8 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       // get the coords of the node
       AmanziMesh::Entity_ID pnode =
           surf_mesh_->entity_get_parent(AmanziMesh::NODE, i);
+      if (!all_nodes_moved && !node_moved[pnode]) continue;
+
       int dim = mesh_->space_dimension();
       AmanziGeometry::Point coord_domain(dim);
       mesh_->node_get_coordinates(pnode, &coord_domain);
@@ -699,9 +722,14 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       surface_nodeids.push_back(i);
       surface_newpos.push_back(coord_surface);
     }
-    AmanziGeometry::Point_List surface_finpos;
-    surf_mesh_nc_->deform(surface_nodeids, surface_newpos, false, &surface_finpos);
-    surf3d_mesh_nc_->deform(surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
+    int nmoved_l = surface_nodeids.size();
+    int nmoved = 0;
+    surf_mesh_->get_comm()->SumAll(&nmoved_l, &nmoved, 1);
+    if (nmoved > 0) {
+      AmanziGeometry::Point_List surface_finpos;
+      surf_mesh_nc_->deform(surface_nodeids, surface_newpos, false, &surface_finpos);
+      surf3d_mesh_nc_->deform(surface3d_nodeids, surface3d_newpos, false, &surface_finpos);
+    }
   }
 
   {  // update vertex coordinates in state (for checkpointing and error recovery)
@@ -711,6 +739,7 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
     int dim = mesh_->space_dimension();
     int nnodes = vc.MyLength();
     for (int i=0; i!=nnodes; ++i) {
+      if (!all_nodes_moved && !node_moved[i]) continue;
       AmanziGeometry::Point coords(dim);
       mesh_->node_get_coordinates(i,&coords);
       for (int s=0; s!=dim; ++s) vc[s][i] = coords[s];
@@ -725,6 +754,8 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
     int dim = surf_mesh_->space_dimension();
     int nnodes = vc.MyLength();
     for (int i=0; i!=nnodes; ++i) {
+      if (!all_nodes_moved &&
+          !node_moved[surf_mesh_->entity_get_parent(AmanziMesh::NODE, i)]) continue;
       AmanziGeometry::Point coords(dim);
       surf_mesh_->node_get_coordinates(i,&coords);
       for (int s=0; s!=dim; ++s) vc[s][i] = coords[s];
@@ -739,6 +770,8 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
     int dim = surf3d_mesh_->space_dimension();
     int nnodes = vc.MyLength();
     for (int i=0; i!=nnodes; ++i) {
+      if (!all_nodes_moved &&
+          !node_moved[surf3d_mesh_->entity_get_parent(AmanziMesh::NODE, i)]) continue;
       AmanziGeometry::Point coords(dim);
       surf3d_mesh_->node_get_coordinates(i,&coords);
       for (int s=0; s!=dim; ++s) vc[s][i] = coords[s];
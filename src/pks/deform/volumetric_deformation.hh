@@ -45,7 +45,9 @@ node coordinate changes.  Three options are available:
   advantage of being simple, it has issues when thaw gradients in the
   horizontal are not zero, as it may result in the loss of volume in a fully
   frozen cell, blowing up the pressure and breaking the code.  This is great
-  when it works, but it almost never works in real problems.
+  when it works, but it almost never works in real problems.  Only the nodes
+  of columns that subside are passed to the mesh (and to the surface meshes),
+  so steps in which few columns change are cheap.
 
 - "global optimization" attempts to directly form and solve the minimization
   problem to find the nodal changes that result in the target volumetric
@@ -103,6 +103,115 @@ LiquidGasEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, dou
   return phi*(ng*sg*ug + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
 }
 
+// batched kernels
+void
+LiquidGasEnergyModel::Energy(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = Energy(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDPorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDBasePorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDBasePorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDSaturationGas(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationGas(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDMolarDensityGas(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityGas(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDInternalEnergyGas(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyGas(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDDensityRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDDensityRock(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDInternalEnergyRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyRock(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidGasEnergyModel::DEnergyDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDCellVolume(phi[i], phi0[i], sl[i], nl[i], ul[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -103,6 +103,115 @@ LiquidIceEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, dou
   return phi*(ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
 }
 
+// batched kernels
+void
+LiquidIceEnergyModel::Energy(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = Energy(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDPorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDBasePorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDBasePorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDSaturationIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationIce(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDMolarDensityIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityIce(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDInternalEnergyIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyIce(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDDensityRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDDensityRock(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDInternalEnergyRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyRock(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+LiquidIceEnergyModel::DEnergyDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDCellVolume(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -33,6 +33,34 @@ class LiquidIceEnergyModel {
   double DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const;
   double DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const;
   double DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const;
+
+  // Batched kernels over n contiguous values.  These are implemented in the
+  // same translation unit as the pointwise methods above, which are inlined
+  // into loops the compiler can vectorize.  Arrays may not alias.
+  void Energy(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDBasePorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDSaturationIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDMolarDensityIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDInternalEnergyIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDDensityRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDInternalEnergyRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -109,20 +109,18 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+    const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+    const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+    const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+    const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+    const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+    const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+    double* result_v = (*result->ViewComponent(*comp,false))[0];
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-    }
+    model_->Energy(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
   }
 }
 
@@ -143,153 +141,137 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
   if (wrt_key == phi_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDPorosity(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == phi0_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDBasePorosity(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == sl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDSaturationLiquid(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDMolarDensityLiquid(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ul_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyLiquid(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == rho_r_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDDensityRock(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ur_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyRock(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == cv_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDCellVolume(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else {
@@ -85,6 +85,88 @@ RichardsEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, doub
   return nl*phi*sl*ul + rho_r*ur*(-phi0 + 1);
 }
 
+// batched kernels
+void
+RichardsEnergyModel::Energy(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = Energy(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDPorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDBasePorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDBasePorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDDensityRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDDensityRock(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDInternalEnergyRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyRock(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+RichardsEnergyModel::DEnergyDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDCellVolume(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -95,19 +95,17 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-    const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* h_v = (*h->ViewComponent(*comp, false))[0];
+    const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+    const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+    const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+    const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+    const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+    double* result_v = (*result->ViewComponent(*comp,false))[0];
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Energy(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-    }
+    model_->Energy(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
   }
 }
 
@@ -127,127 +125,113 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
   if (wrt_key == h_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPondedDepth(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDPondedDepth(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else if (wrt_key == eta_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDUnfrozenFraction(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDUnfrozenFraction(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDMolarDensityLiquid(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ul_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyLiquid(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ni_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDMolarDensityIce(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ui_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyIce(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else if (wrt_key == cv_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDCellVolume(ncomp, h_v, eta_v, nl_v, ul_v, ni_v, ui_v, cv_v, result_v);
     }
 
   } else {
@@ -79,6 +79,79 @@ SurfaceIceEnergyModel::DEnergyDCellVolume(double h, double eta, double nl, doubl
   return h*(eta*nl*ul + ni*ui*(-eta + 1));
 }
 
+// batched kernels
+void
+SurfaceIceEnergyModel::Energy(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = Energy(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDPondedDepth(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDPondedDepth(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDUnfrozenFraction(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDUnfrozenFraction(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDMolarDensityLiquid(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityLiquid(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyLiquid(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDMolarDensityIce(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityIce(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDInternalEnergyIce(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyIce(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDCellVolume(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDCellVolume(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
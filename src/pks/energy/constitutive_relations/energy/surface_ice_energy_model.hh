@@ -29,6 +29,26 @@ class SurfaceIceEnergyModel {
   double DEnergyDMolarDensityIce(double h, double eta, double nl, double ul, double ni, double ui, double cv) const;
   double DEnergyDInternalEnergyIce(double h, double eta, double nl, double ul, double ni, double ui, double cv) const;
   double DEnergyDCellVolume(double h, double eta, double nl, double ul, double ni, double ui, double cv) const;
+
+  // Batched kernels over n contiguous values.  These are implemented in the
+  // same translation unit as the pointwise methods above, which are inlined
+  // into loops the compiler can vectorize.  Arrays may not alias.
+  void Energy(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDPondedDepth(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDUnfrozenFraction(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDMolarDensityLiquid(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDMolarDensityIce(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDInternalEnergyIce(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DEnergyDCellVolume(int n, const double* __restrict__ h, const double* __restrict__ eta, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ cv,
+        double* __restrict__ result) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -151,26 +151,24 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+    const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+    const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+    const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+    const double* si_v = (*si->ViewComponent(*comp, false))[0];
+    const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+    const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+    const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+    const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+    const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+    const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+    const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+    const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+    double* result_v = (*result->ViewComponent(*comp,false))[0];
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-    }
+    model_->Energy(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
   }
 }
 
@@ -197,351 +195,323 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
   if (wrt_key == phi_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDPorosity(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == phi0_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDBasePorosity(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == sl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDSaturationLiquid(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDMolarDensityLiquid(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ul_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyLiquid(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == si_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationIce(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDSaturationIce(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ni_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDMolarDensityIce(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ui_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyIce(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == sg_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationGas(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDSaturationGas(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ng_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityGas(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDMolarDensityGas(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ug_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyGas(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyGas(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == rho_r_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDDensityRock(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ur_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDInternalEnergyRock(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else if (wrt_key == cv_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* ug_v = (*ug->ViewComponent(*comp, false))[0];
+      const double* rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
-      }
+      model_->DEnergyDCellVolume(ncomp, phi_v, phi0_v, sl_v, nl_v, ul_v, si_v, ni_v, ui_v, sg_v, ng_v, ug_v, rho_r_v, ur_v, cv_v, result_v);
     }
 
   } else {
@@ -121,6 +121,142 @@ ThreePhaseEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, do
   return phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
 }
 
+// batched kernels
+void
+ThreePhaseEnergyModel::Energy(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = Energy(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDPorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDBasePorosity(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDBasePorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyLiquid(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDSaturationIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationIce(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDMolarDensityIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityIce(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyIce(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyIce(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDSaturationGas(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDSaturationGas(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDMolarDensityGas(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDMolarDensityGas(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyGas(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyGas(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDDensityRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDDensityRock(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyRock(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDInternalEnergyRock(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ phi0, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ ul, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ ui, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ ug, const double* __restrict__ rho_r, const double* __restrict__ ur, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DEnergyDCellVolume(phi[i], phi0[i], sl[i], nl[i], ul[i], si[i], ni[i], ui[i], sg[i], ng[i], ug[i], rho_r[i], ur[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
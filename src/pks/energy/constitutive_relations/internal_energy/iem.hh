@@ -28,6 +28,16 @@ public:
   virtual bool IsMolarBasis() = 0;
   virtual double InternalEnergy(double temp) = 0;
   virtual double DInternalEnergyDT(double temp) = 0;
+
+  // Batched versions, evaluating n values at once.  The defaults call the
+  // pointwise methods; implementations may override these to avoid the
+  // virtual call per value.
+  virtual void InternalEnergyBatch(const double* temp, double* result, int n) {
+    for (int i=0; i!=n; ++i) result[i] = InternalEnergy(temp[i]);
+  }
+  virtual void DInternalEnergyDTBatch(const double* temp, double* result, int n) {
+    for (int i=0; i!=n; ++i) result[i] = DInternalEnergyDT(temp[i]);
+  }
 };
 
 }
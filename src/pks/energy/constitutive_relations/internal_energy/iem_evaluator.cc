@@ -65,9 +65,7 @@ void IEMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = iem_->InternalEnergy(temp_v[0][i]);
-    }
+    iem_->InternalEnergyBatch(temp_v[0], result_v[0], ncomp);
   }
 }
 
@@ -83,9 +81,7 @@ void IEMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
     Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = iem_->DInternalEnergyDT(temp_v[0][i]);
-    }
+    iem_->DInternalEnergyDTBatch(temp_v[0], result_v[0], ncomp);
   }
 }
 
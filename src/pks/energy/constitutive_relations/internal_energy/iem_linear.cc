@@ -31,6 +31,15 @@ double IEMLinear::InternalEnergy(double temp) {
   return L_ + Cv_ * (temp - T_ref_);
 };
 
+// batched versions, without a virtual call per value
+void IEMLinear::InternalEnergyBatch(const double* temp, double* result, int n) {
+  for (int i=0; i!=n; ++i) result[i] = IEMLinear::InternalEnergy(temp[i]);
+}
+
+void IEMLinear::DInternalEnergyDTBatch(const double* temp, double* result, int n) {
+  for (int i=0; i!=n; ++i) result[i] = IEMLinear::DInternalEnergyDT(temp[i]);
+}
+
 void IEMLinear::InitializeFromPlist_() {
   if (plist_.isParameter("heat capacity [J kg^-1 K^-1]")) {
     Cv_ = 1.e-6 * plist_.get<double>("heat capacity [J kg^-1 K^-1]");
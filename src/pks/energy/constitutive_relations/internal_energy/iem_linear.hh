@@ -55,6 +55,9 @@ public:
   double InternalEnergy(double temp);
   double DInternalEnergyDT(double temp) { return Cv_; }
 
+  void InternalEnergyBatch(const double* temp, double* result, int n);
+  void DInternalEnergyDTBatch(const double* temp, double* result, int n);
+
 private:
   virtual void InitializeFromPlist_();
 
@@ -36,6 +36,15 @@ double IEMQuadratic::DInternalEnergyDT(double temp) {
   return ka_ + 2.0*kb_*dT;
 };
 
+// batched versions, without a virtual call per value
+void IEMQuadratic::InternalEnergyBatch(const double* temp, double* result, int n) {
+  for (int i=0; i!=n; ++i) result[i] = IEMQuadratic::InternalEnergy(temp[i]);
+}
+
+void IEMQuadratic::DInternalEnergyDTBatch(const double* temp, double* result, int n) {
+  for (int i=0; i!=n; ++i) result[i] = IEMQuadratic::DInternalEnergyDT(temp[i]);
+}
+
 void IEMQuadratic::InitializeFromPlist_() {
   if (plist_.isParameter("quadratic u_0 [J kg^-1]")) {
     u0_ = 1.e-6 * plist_.get<double>("latent heat [J kg^-1]");
@@ -57,6 +57,9 @@ public:
   double InternalEnergy(double temp);
   double DInternalEnergyDT(double temp);
 
+  void InternalEnergyBatch(const double* temp, double* result, int n);
+  void DInternalEnergyDTBatch(const double* temp, double* result, int n);
+
 private:
   virtual void InitializeFromPlist_();
 
@@ -41,6 +41,16 @@ public:
     AMANZI_ASSERT(false);
     return 0.;
   }
+
+  // Batched version, evaluating n values at once.  The default calls the
+  // pointwise method; implementations may override this to avoid the virtual
+  // call per value.
+  virtual void ThermalConductivityBatch(const double* porosity, const double* sat_liq,
+          const double* sat_ice, const double* temp, double* result, int n) {
+    for (int i=0; i!=n; ++i) {
+      result[i] = ThermalConductivity(porosity[i], sat_liq[i], sat_ice[i], temp[i]);
+    }
+  }
 };
 
 } // namespace
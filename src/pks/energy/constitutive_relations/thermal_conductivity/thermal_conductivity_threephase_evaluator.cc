@@ -8,6 +8,7 @@
   Satish Karra (satkarra@lanl.gov)
 */
 
+#include <algorithm>
 #include "dbc.hh"
 #include "thermal_conductivity_threephase_factory.hh"
 #include "thermal_conductivity_threephase_evaluator.hh"
@@ -64,7 +65,9 @@ ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
     temp_key_(other.temp_key_),
     sat_key_(other.sat_key_),
     sat2_key_(other.sat2_key_),
-    tcs_(other.tcs_) {}
+    tcs_(other.tcs_),
+    region_cells_(other.region_cells_),
+    buffers_(other.buffers_) {}
 
 Teuchos::RCP<FieldEvaluator>
 ThermalConductivityThreePhaseEvaluator::Clone() const {
@@ -72,6 +75,27 @@ ThermalConductivityThreePhaseEvaluator::Clone() const {
 }
 
 
+// Cells of each region, looked up once as mesh sets are expensive to query.
+void ThermalConductivityThreePhaseEvaluator::InitializeRegionCells_(
+    const AmanziMesh::Mesh& mesh) {
+  region_cells_.resize(tcs_.size());
+  std::size_t max_size = 0;
+  for (int r=0; r!=tcs_.size(); ++r) {
+    const std::string& region_name = tcs_[r].first;
+    if (mesh.valid_set_name(region_name, AmanziMesh::CELL)) {
+      mesh.get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &region_cells_[r]);
+      max_size = std::max(max_size, region_cells_[r].size());
+    } else {
+      std::stringstream m;
+      m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
+      Errors::Message message(m.str());
+      Exceptions::amanzi_throw(message);
+    }
+  }
+  for (int j=0; j!=5; ++j) buffers_[j].resize(max_size);
+}
+
+
 void ThermalConductivityThreePhaseEvaluator::EvaluateField_(
     const Teuchos::Ptr<State>& S,
     const Teuchos::Ptr<CompositeVector>& result) {
@@ -80,37 +104,31 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateField_(
   Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
   Teuchos::RCP<const CompositeVector> sat = S->GetFieldData(sat_key_);
   Teuchos::RCP<const CompositeVector> sat2 = S->GetFieldData(sat2_key_);
-  Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
+  if (region_cells_.size() == 0) InitializeRegionCells_(*result->Mesh());
 
   for (CompositeVector::name_iterator comp = result->begin();
        comp!=result->end(); ++comp) {
     AMANZI_ASSERT(*comp == "cell");
-    const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp,false);
-    const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp,false);
-    const Epetra_MultiVector& sat_v = *sat->ViewComponent(*comp,false);
-    const Epetra_MultiVector& sat2_v = *sat2->ViewComponent(*comp,false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
-
-    for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin();
-         lcv != tcs_.end(); ++lcv) {
-      std::string region_name = lcv->first;
-      if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-        // get the indices of the domain.
-        AmanziMesh::Entity_ID_List id_list;
-        mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-        // loop over indices
-        for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
-             id!=id_list.end(); ++id) {
-          result_v[0][*id] = lcv->second->ThermalConductivity(poro_v[0][*id],
-                  sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-        }
-      } else {
-        std::stringstream m;
-        m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-        Errors::Message message(m.str());
-        Exceptions::amanzi_throw(message);
+    const double* inputs[4] = { (*poro->ViewComponent(*comp,false))[0],
+                                (*sat->ViewComponent(*comp,false))[0],
+                                (*sat2->ViewComponent(*comp,false))[0],
+                                (*temp->ViewComponent(*comp,false))[0] };
+    double* result_v = (*result->ViewComponent(*comp,false))[0];
+
+    // gather each region's inputs into contiguous buffers and evaluate the
+    // region's model on all of them at once
+    for (int r=0; r!=tcs_.size(); ++r) {
+      const AmanziMesh::Entity_ID_List& cells = region_cells_[r];
+      int n = cells.size();
+      if (buffers_[0].size() < n) {
+        for (auto& buffer : buffers_) buffer.resize(n);
+      }
+      for (int j=0; j!=4; ++j) {
+        for (int i=0; i!=n; ++i) buffers_[j][i] = inputs[j][cells[i]];
       }
+      tcs_[r].second->ThermalConductivityBatch(buffers_[0].data(), buffers_[1].data(),
+              buffers_[2].data(), buffers_[3].data(), buffers_[4].data(), n);
+      for (int i=0; i!=n; ++i) result_v[cells[i]] = buffers_[4][i];
     }
   }
   result->Scale(1.e-6); // convert to MJ
@@ -125,7 +143,21 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateFieldPartialDerivative_(
   Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
   Teuchos::RCP<const CompositeVector> sat = S->GetFieldData(sat_key_);
   Teuchos::RCP<const CompositeVector> sat2 = S->GetFieldData(sat2_key_);
-  Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
+  if (region_cells_.size() == 0) InitializeRegionCells_(*result->Mesh());
+
+  typedef double(ThermalConductivityThreePhase::*DerivFn)(double,double,double,double);
+  DerivFn deriv = nullptr;
+  if (wrt_key == poro_key_) {
+    deriv = &ThermalConductivityThreePhase::DThermalConductivity_DPorosity;
+  } else if (wrt_key == sat_key_) {
+    deriv = &ThermalConductivityThreePhase::DThermalConductivity_DSaturationLiquid;
+  } else if (wrt_key == sat2_key_) {
+    deriv = &ThermalConductivityThreePhase::DThermalConductivity_DSaturationIce;
+  } else if (wrt_key == temp_key_) {
+    deriv = &ThermalConductivityThreePhase::DThermalConductivity_DTemperature;
+  } else {
+    AMANZI_ASSERT(false);
+  }
 
   for (CompositeVector::name_iterator comp = result->begin();
        comp!=result->end(); ++comp) {
@@ -136,106 +168,15 @@ void ThermalConductivityThreePhaseEvaluator::EvaluateFieldPartialDerivative_(
     const Epetra_MultiVector& sat2_v = *sat2->ViewComponent(*comp,false);
     Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
 
-    if (wrt_key == poro_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin();
-           lcv != tcs_.end(); ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
-               id!=id_list.end(); ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DPorosity(poro_v[0][*id],
-                                              sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
-      }
-      
-    } else if (wrt_key == sat_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin();
-           lcv != tcs_.end(); ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
-               id!=id_list.end(); ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DSaturationLiquid(
-                                    poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
-      }
-
-    } else if (wrt_key == sat2_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin();
-           lcv != tcs_.end(); ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
-               id!=id_list.end(); ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DSaturationIce(
-                                    poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
+    for (int r=0; r!=tcs_.size(); ++r) {
+      ThermalConductivityThreePhase& tc = *tcs_[r].second;
+      for (AmanziMesh::Entity_ID c : region_cells_[r]) {
+        result_v[0][c] = (tc.*deriv)(poro_v[0][c], sat_v[0][c], sat2_v[0][c], temp_v[0][c]);
       }
-
-    } else if (wrt_key == temp_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin();
-           lcv != tcs_.end(); ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id=id_list.begin();
-               id!=id_list.end(); ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DTemperature(
-                                    poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
-      }
-      
-    } else {
-      AMANZI_ASSERT(false);
     }
   }
-    
-  result->Scale(1.e-6); // convert to MJ
 
-  Epetra_MultiVector& result_v = *result->ViewComponent("cell",false);
+  result->Scale(1.e-6); // convert to MJ
 }
 
 
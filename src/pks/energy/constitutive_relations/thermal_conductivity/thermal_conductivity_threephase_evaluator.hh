@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "secondary_variable_field_evaluator.hh"
 #include "thermal_conductivity_threephase.hh"
 
@@ -35,9 +37,14 @@ class ThermalConductivityThreePhaseEvaluator :
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+ protected:
+  void InitializeRegionCells_(const AmanziMesh::Mesh& mesh);
+
  protected:
   
   std::vector<RegionModelPair> tcs_;
+  std::vector<AmanziMesh::Entity_ID_List> region_cells_;
+  std::array<std::vector<double>,5> buffers_;
 
   // Keys for fields
   // dependencies
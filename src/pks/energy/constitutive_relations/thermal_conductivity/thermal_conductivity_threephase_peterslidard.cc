@@ -31,6 +31,15 @@ double ThermalConductivityThreePhasePetersLidard::ThermalConductivity(double por
     + (1.0 - kersten_f - kersten_u) * k_dry;
 };
 
+// batched version, without a virtual call per value
+void ThermalConductivityThreePhasePetersLidard::ThermalConductivityBatch(const double* poro,
+        const double* sat_liq, const double* sat_ice, const double* temp,
+        double* result, int n) {
+  for (int i=0; i!=n; ++i) {
+    result[i] = ThermalConductivityThreePhasePetersLidard::ThermalConductivity(poro[i], sat_liq[i], sat_ice[i], temp[i]);
+  }
+}
+
 void ThermalConductivityThreePhasePetersLidard::InitializeFromPlist_() {
   d_ = 0.053; // unitless empericial parameter
 
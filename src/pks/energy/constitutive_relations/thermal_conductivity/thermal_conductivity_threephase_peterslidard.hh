@@ -61,6 +61,8 @@ public:
   ThermalConductivityThreePhasePetersLidard(Teuchos::ParameterList& plist);
 
   double ThermalConductivity(double porosity, double sat_liq, double sat_ice, double temp);
+  void ThermalConductivityBatch(const double* porosity, const double* sat_liq,
+          const double* sat_ice, const double* temp, double* result, int n);
 
 private:
   void InitializeFromPlist_();
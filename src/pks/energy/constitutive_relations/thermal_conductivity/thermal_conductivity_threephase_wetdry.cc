@@ -71,6 +71,15 @@ ThermalConductivityThreePhaseWetDry::DThermalConductivity_DTemperature(double po
 }
 
 
+// batched version, without a virtual call per value
+void ThermalConductivityThreePhaseWetDry::ThermalConductivityBatch(const double* poro,
+        const double* sat_liq, const double* sat_ice, const double* temp,
+        double* result, int n) {
+  for (int i=0; i!=n; ++i) {
+    result[i] = ThermalConductivityThreePhaseWetDry::ThermalConductivity(poro[i], sat_liq[i], sat_ice[i], temp[i]);
+  }
+}
+
 void ThermalConductivityThreePhaseWetDry::InitializeFromPlist_() {
   eps_ = plist_.get<double>("epsilon [-]", 1.e-10);
   alpha_u_ = plist_.get<double>("unsaturated alpha unfrozen [-]");
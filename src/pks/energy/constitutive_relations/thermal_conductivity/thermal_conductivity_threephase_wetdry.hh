@@ -59,6 +59,8 @@ public:
   ThermalConductivityThreePhaseWetDry(Teuchos::ParameterList& plist);
 
   double ThermalConductivity(double porosity, double sat_liq, double sat_ice, double temp);
+  void ThermalConductivityBatch(const double* porosity, const double* sat_liq,
+          const double* sat_ice, const double* temp, double* result, int n);
   double DThermalConductivity_DPorosity(double porosity, double sat_liq, double sat_ice, double temp);
   double DThermalConductivity_DSaturationLiquid(double porosity, double sat_liq, double sat_ice, double temp);
   double DThermalConductivity_DSaturationIce(double porosity, double sat_liq, double sat_ice, double temp);
@@ -273,7 +273,7 @@ void EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
 // -----------------------------------------------------------------------------
 // Default enorm that uses an abs and rel tolerance to monitor convergence.
 // -----------------------------------------------------------------------------
-double EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u,
+double EnergyBase::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
         Teuchos::RCP<const TreeVector> res) {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
@@ -299,12 +299,8 @@ double EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u,
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_next_->time() - S_inter_->time();
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
   double enorm_val = 0.0;
+  std::vector<ENorm_t> enorms;
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
@@ -330,14 +326,14 @@ double EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
+      const std::vector<int>& face_cells = FaceCells_();
 
       for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double mass_min = cells.size() == 1 ? wc[0][cells[0]]/cv[0][cells[0]]
-          : std::min(wc[0][cells[0]]/cv[0][cells[0]], wc[0][cells[1]]/cv[0][cells[1]]);
+        int c0 = face_cells[2*f];
+        int c1 = face_cells[2*f+1];
+        double cv_min = c1 < 0 ? cv[0][c0] : std::min(cv[0][c0], cv[0][c1]);
+        double mass_min = c1 < 0 ? wc[0][c0]/cv[0][c0]
+          : std::min(wc[0][c0]/cv[0][c0], wc[0][c1]/cv[0][c1]);
         mass_min = std::max(mass_min, mass_atol_);
 
         double energy = mass_min * atol_ + soil_atol_;
@@ -358,30 +354,15 @@ double EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     }
 
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
-    }
-
+    ENorm_t err;
+    err.value = enorm_comp;
+    err.gid = enorm_loc;
+    enorms.push_back(err);
     enorm_val = std::max(enorm_val, enorm_comp);
   }
 
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
+  // Write out Inf norms too.
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) WriteErrorNorms_(*dvec, enorms);
   return enorm_val;
 };
 
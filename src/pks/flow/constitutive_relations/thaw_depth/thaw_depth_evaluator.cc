@@ -39,28 +39,16 @@ ThawDepthEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const auto& temp_c = *S->GetFieldData(temp_key_)->ViewComponent("cell", false);
 
   // search through the column and find the first frozen cell
-  const auto& surf_mesh = S->GetMesh(domain_);
-  const auto& subsurf_mesh = S->GetMesh(domain_ss_);
-  int z_dim = subsurf_mesh->space_dimension() - 1;
-
-  double trans_temp = 273.15 + 0.5*trans_width_;
-
-  for (AmanziMesh::Entity_ID sc=0; sc!=res_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID top_f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
-    double top_z = subsurf_mesh->face_centroid(top_f)[z_dim];
-    
-    double thaw_z = std::numeric_limits<double>::quiet_NaN();
-    for (int i=0; i!=subsurf_mesh->cells_of_column(sc).size(); ++i) {
-      AmanziMesh::Entity_ID c = subsurf_mesh->cells_of_column(sc)[i];
-      if (temp_c[0][c] < trans_temp) {
-        // find the face above
-        AmanziMesh::Entity_ID f_up = subsurf_mesh->faces_of_column(sc)[i];
-        thaw_z = subsurf_mesh->face_centroid(f_up)[z_dim];
-        break;
-      }
-    }
-    res_c[0][sc] = top_z - thaw_z;
+  if (columns_ == Teuchos::null) {
+    columns_ = Teuchos::rcp(new Relations::ColumnReductions(*S->GetMesh(domain_), S->GetMesh(domain_ss_)));
+  } else if (S->IsDeformableMesh(domain_ss_)) {
+    columns_->UpdateElevations(*S->GetMesh(domain_ss_));
   }
+
+  std::vector<Relations::ColumnReduction> reductions(1,
+          Relations::ColumnReduction(Relations::ColumnReduction::DEPTH_TO_FIRST_BELOW, temp_c[0], res_c[0]));
+  reductions[0].threshold = 273.15 + 0.5*trans_width_;
+  columns_->Evaluate(reductions);
 }
   
  
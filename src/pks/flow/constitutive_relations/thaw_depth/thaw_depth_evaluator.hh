@@ -29,6 +29,7 @@ Evaluator name: `"thaw depth`"
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "ColumnReductions.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -61,6 +62,9 @@ class ThawDepthEvaluator : public SecondaryVariableFieldEvaluator {
   Key domain_, domain_ss_;
   Key temp_key_;
 
+  // column structure, cached on first evaluation
+  Teuchos::RCP<Relations::ColumnReductions> columns_;
+
  private:
   static Utils::RegisteredFactory<FieldEvaluator,ThawDepthEvaluator> reg_;
 
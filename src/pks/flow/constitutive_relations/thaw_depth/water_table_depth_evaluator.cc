@@ -37,26 +37,16 @@ WaterTableDepthEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const auto& sat_c = *S->GetFieldData(sat_key_)->ViewComponent("cell", false);
 
   // search through the column and find the first saturated cell
-  const auto& surf_mesh = S->GetMesh(domain_);
-  const auto& subsurf_mesh = S->GetMesh(domain_ss_);
-  int z_dim = subsurf_mesh->space_dimension() - 1;
-
-  for (AmanziMesh::Entity_ID sc=0; sc!=res_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID top_f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
-    double top_z = subsurf_mesh->face_centroid(top_f)[z_dim];
-    
-    double wt_z = std::numeric_limits<double>::quiet_NaN();
-    for (int i=0; i!=subsurf_mesh->cells_of_column(sc).size(); ++i) {
-      AmanziMesh::Entity_ID c = subsurf_mesh->cells_of_column(sc)[i];
-      if (sat_c[0][c] == 0.) {
-        // find the face above
-        AmanziMesh::Entity_ID f_up = subsurf_mesh->faces_of_column(sc)[i];
-        wt_z = subsurf_mesh->face_centroid(f_up)[z_dim];
-        break;
-      }
-    }
-    res_c[0][sc] = top_z - wt_z;
+  if (columns_ == Teuchos::null) {
+    columns_ = Teuchos::rcp(new Relations::ColumnReductions(*S->GetMesh(domain_), S->GetMesh(domain_ss_)));
+  } else if (S->IsDeformableMesh(domain_ss_)) {
+    columns_->UpdateElevations(*S->GetMesh(domain_ss_));
   }
+
+  std::vector<Relations::ColumnReduction> reductions(1,
+          Relations::ColumnReduction(Relations::ColumnReduction::DEPTH_TO_FIRST_EQUAL, sat_c[0], res_c[0]));
+  reductions[0].threshold = 0.;
+  columns_->Evaluate(reductions);
 }
 
   
@@ -32,6 +32,7 @@ Evaluator name: `"water table depth`"
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "ColumnReductions.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -64,6 +65,9 @@ class WaterTableDepthEvaluator : public SecondaryVariableFieldEvaluator {
   Key sat_key_;
   Key domain_, domain_ss_;
 
+  // column structure, cached on first evaluation
+  Teuchos::RCP<Relations::ColumnReductions> columns_;
+
  private:
   static Utils::RegisteredFactory<FieldEvaluator,WaterTableDepthEvaluator> reg_;
 
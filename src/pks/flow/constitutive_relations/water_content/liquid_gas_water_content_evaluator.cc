@@ -95,19 +95,17 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-    const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+    const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+    const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+    const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+    const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+    const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+    double* result_v = (*result->ViewComponent(*comp,false))[0];
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->WaterContent(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-    }
+    model_->WaterContent(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
   }
 }
 
@@ -127,127 +125,113 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
   if (wrt_key == phi_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDPorosity(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDPorosity(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else if (wrt_key == sl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationLiquid(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDSaturationLiquid(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityLiquid(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDMolarDensityLiquid(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else if (wrt_key == sg_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationGas(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDSaturationGas(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else if (wrt_key == ng_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityGas(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDMolarDensityGas(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else if (wrt_key == omega_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolFracGas(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDMolFracGas(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else if (wrt_key == cv_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* ng_v = (*ng->ViewComponent(*comp, false))[0];
+      const double* omega_v = (*omega->ViewComponent(*comp, false))[0];
+      const double* cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* result_v = (*result->ViewComponent(*comp,false))[0];
 
       int ncomp = result->size(*comp, false);
-      for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDCellVolume(phi_v[0][i], sl_v[0][i], nl_v[0][i], sg_v[0][i], ng_v[0][i], omega_v[0][i], cv_v[0][i]);
-      }
+      model_->DWaterContentDCellVolume(ncomp, phi_v, sl_v, nl_v, sg_v, ng_v, omega_v, cv_v, result_v);
     }
 
   } else {
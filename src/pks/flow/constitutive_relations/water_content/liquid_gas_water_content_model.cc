@@ -79,6 +79,79 @@ LiquidGasWaterContentModel::DWaterContentDCellVolume(double phi, double sl, doub
   return phi*(ng*omega*sg + nl*sl);
 }
 
+// batched kernels
+void
+LiquidGasWaterContentModel::WaterContent(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = WaterContent(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDSaturationGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationGas(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDMolarDensityGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityGas(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDMolFracGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolFracGas(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -29,6 +29,26 @@ class LiquidGasWaterContentModel {
   double DWaterContentDMolarDensityGas(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const;
   double DWaterContentDMolFracGas(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const;
   double DWaterContentDCellVolume(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const;
+
+  // Batched kernels over n contiguous values.  These are implemented in the
+  // same translation unit as the pointwise methods above, which are inlined
+  // into loops the compiler can vectorize.  Arrays may not alias.
+  void WaterContent(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDSaturationGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDMolarDensityGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDMolFracGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -73,6 +73,70 @@ LiquidIceWaterContentModel::DWaterContentDCellVolume(double phi, double sl, doub
   return phi*(ni*si + nl*sl);
 }
 
+// batched kernels
+void
+LiquidIceWaterContentModel::WaterContent(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = WaterContent(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDSaturationIce(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationIce(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDMolarDensityIce(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityIce(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -61,6 +61,52 @@ RichardsWaterContentModel::DWaterContentDCellVolume(double phi, double sl, doubl
   return nl*phi*sl;
 }
 
+// batched kernels
+void
+RichardsWaterContentModel::WaterContent(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = WaterContent(phi[i], sl[i], nl[i], cv[i]);
+  }
+}
+
+void
+RichardsWaterContentModel::DWaterContentDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], cv[i]);
+  }
+}
+
+void
+RichardsWaterContentModel::DWaterContentDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], cv[i]);
+  }
+}
+
+void
+RichardsWaterContentModel::DWaterContentDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], cv[i]);
+  }
+}
+
+void
+RichardsWaterContentModel::DWaterContentDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
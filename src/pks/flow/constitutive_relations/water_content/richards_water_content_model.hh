@@ -26,6 +26,20 @@ class RichardsWaterContentModel {
   double DWaterContentDSaturationLiquid(double phi, double sl, double nl, double cv) const;
   double DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double cv) const;
   double DWaterContentDCellVolume(double phi, double sl, double nl, double cv) const;
+
+  // Batched kernels over n contiguous values.  These are implemented in the
+  // same translation unit as the pointwise methods above, which are inlined
+  // into loops the compiler can vectorize.  Arrays may not alias.
+  void WaterContent(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const;
+  void DWaterContentDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ cv,
+        double* __restrict__ result) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
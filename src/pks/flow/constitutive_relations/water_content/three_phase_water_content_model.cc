@@ -91,6 +91,97 @@ ThreePhaseWaterContentModel::DWaterContentDCellVolume(double phi, double sl, dou
   return phi*(ng*omega*sg + ni*si + nl*sl);
 }
 
+// batched kernels
+void
+ThreePhaseWaterContentModel::WaterContent(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = WaterContent(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDPorosity(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDSaturationLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityLiquid(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDSaturationIce(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationIce(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityIce(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityIce(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDSaturationGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDSaturationGas(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolarDensityGas(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolFracGas(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDMolFracGas(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDCellVolume(int n, const double* __restrict__ phi, const double* __restrict__ sl, const double* __restrict__ nl, const double* __restrict__ si, const double* __restrict__ ni, const double* __restrict__ sg, const double* __restrict__ ng, const double* __restrict__ omega, const double* __restrict__ cv,
+        double* __restrict__ result) const
+{
+  for (int i=0; i!=n; ++i) {
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
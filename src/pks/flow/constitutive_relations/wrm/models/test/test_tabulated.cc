@@ -0,0 +1,49 @@
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_tabulated.hh"
+
+TEST(tabulated_vanGenuchten) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m [-]", 0.4);
+  plist.set("van Genuchten alpha [Pa^-1]", 2.e-4);
+  plist.set("residual saturation [-]", 0.1);
+  plist.set("smoothing interval width [saturation]", 0.05);
+  Teuchos::RCP<WRM> vG = Teuchos::rcp(new WRMVanGenuchten(plist));
+
+  double tol = 1.e-8;
+  plist.set("lookup table tolerance", tol);
+  WRMTabulated table(plist, vG);
+
+  // saturation within tolerance across the table, and monotone
+  double s_prev = 1.0;
+  for (int i=0; i!=10000; ++i) {
+    double pc = std::pow(10., -2. + 9. * i / 10000);
+    double s = table.saturation(pc);
+    CHECK_CLOSE(vG->saturation(pc), s, tol);
+    CHECK(s <= s_prev);
+    s_prev = s;
+  }
+
+  // relative permeability within tolerance
+  for (int i=0; i!=10001; ++i) {
+    double s = 0.1 + 0.9 * i / 10000;
+    CHECK_CLOSE(vG->k_relative(s), table.k_relative(s), tol);
+  }
+
+  // derivatives are consistent with the tabulated values
+  double pc = 5000.;
+  double eps = 1.e-3;
+  CHECK_CLOSE((table.saturation(pc+eps) - table.saturation(pc-eps)) / (2*eps),
+              table.d_saturation(pc), 1.e-9);
+  CHECK_CLOSE(vG->d_saturation(pc), table.d_saturation(pc), 1.e-7);
+
+  // outside of the table, the WRM is used directly
+  CHECK_EQUAL(vG->saturation(-1000.), table.saturation(-1000.));
+  CHECK_EQUAL(vG->saturation(1.e9), table.saturation(1.e9));
+  CHECK_EQUAL(vG->capillaryPressure(0.5), table.capillaryPressure(0.5));
+}
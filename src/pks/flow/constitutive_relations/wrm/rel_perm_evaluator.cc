@@ -175,9 +175,10 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
   int ncells = res_c.MyLength();
+  if (!batches_.initialized()) batches_.Initialize(*wrms_->first, ncells);
+  batches_.Evaluate(wrms_->second, &WRM::k_relative_batch, sat_c[0], res_c[0]);
   for (unsigned int c=0; c!=ncells; ++c) {
-    int index = (*wrms_->first)[c];
-    res_c[0][c] = std::max(wrms_->second[index]->k_relative(sat_c[0][c]), min_val_);
+    res_c[0][c] = std::max(res_c[0][c], min_val_);
   }
 
   // -- Potentially evaluate the model on boundary faces as well.
@@ -293,9 +294,9 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
     Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
     int ncells = res_c.MyLength();
+    if (!batches_.initialized()) batches_.Initialize(*wrms_->first, ncells);
+    batches_.Evaluate(wrms_->second, &WRM::d_k_relative_batch, sat_c[0], res_c[0]);
     for (unsigned int c=0; c!=ncells; ++c) {
-      int index = (*wrms_->first)[c];
-      res_c[0][c] = wrms_->second[index]->d_k_relative(sat_c[0][c]);
       AMANZI_ASSERT(res_c[0][c] >= 0.);
     }
 
@@ -99,6 +99,7 @@ class RelPermEvaluator : public SecondaryVariableFieldEvaluator {
   void InitializeFromPlist_();
 
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMRegionBatches batches_;
   Key sat_key_;
   Key dens_key_;
   Key visc_key_;
@@ -35,6 +35,22 @@ public:
   virtual double d_capillaryPressure(double saturation) = 0;
   virtual double residualSaturation() = 0;
 
+  // Batched versions, evaluating n values at once.  The defaults call the
+  // pointwise methods; implementations may override these to avoid the
+  // virtual call per value.
+  virtual void saturation_batch(const double* pc, double* s, int n) {
+    for (int i=0; i!=n; ++i) s[i] = saturation(pc[i]);
+  }
+  virtual void d_saturation_batch(const double* pc, double* ds, int n) {
+    for (int i=0; i!=n; ++i) ds[i] = d_saturation(pc[i]);
+  }
+  virtual void k_relative_batch(const double* s, double* kr, int n) {
+    for (int i=0; i!=n; ++i) kr[i] = k_relative(s[i]);
+  }
+  virtual void d_k_relative_batch(const double* s, double* dkr, int n) {
+    for (int i=0; i!=n; ++i) dkr[i] = d_k_relative(s[i]);
+  }
+
 };
 
 typedef double(WRM::*KRelFn)(double pc);
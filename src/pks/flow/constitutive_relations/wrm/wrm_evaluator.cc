@@ -85,11 +85,9 @@ void WRMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
-  // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->saturation(pres_c[0][c]);
-  }
+  // calculate cell values, a region at a time
+  if (!batches_.initialized()) batches_.Initialize(*wrms_->first, sat_c.MyLength());
+  batches_.Evaluate(wrms_->second, &WRM::saturation_batch, pres_c[0], sat_c[0]);
 
   // Potentially do face values as well.
   if (results[0]->HasComponent("boundary_face")) {
@@ -152,11 +150,9 @@ void WRMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
-  // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->d_saturation(pres_c[0][c]);
-  }
+  // calculate cell values, a region at a time
+  if (!batches_.initialized()) batches_.Initialize(*wrms_->first, sat_c.MyLength());
+  batches_.Evaluate(wrms_->second, &WRM::d_saturation_batch, pres_c[0], sat_c[0]);
 
   // Potentially do face values as well.
   if (results[0]->HasComponent("boundary_face")) {
@@ -66,6 +66,7 @@ class WRMEvaluator : public SecondaryVariablesFieldEvaluator {
 
  protected:
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMRegionBatches batches_;
   bool calc_other_sat_;
   Key cap_pres_key_;
 
@@ -5,9 +5,11 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include <algorithm>
 #include "dbc.hh"
 #include "wrm_factory.hh"
 #include "wrm_permafrost_factory.hh"
+#include "wrm_tabulated.hh"
 #include "wrm_partition.hh"
 
 
@@ -27,7 +29,11 @@ createWRMPartition(Teuchos::ParameterList& plist) {
     if (plist.isSublist(name)) {
       Teuchos::ParameterList sublist = plist.sublist(name);
       region_list.push_back(sublist.get<std::string>("region"));
-      wrm_list.push_back(fac.createWRM(sublist));
+      Teuchos::RCP<WRM> wrm = fac.createWRM(sublist);
+      if (sublist.get<bool>("use lookup table", false)) {
+        wrm = Teuchos::rcp(new WRMTabulated(sublist, wrm));
+      }
+      wrm_list.push_back(wrm);
     } else {
       AMANZI_ASSERT(0);
     }
@@ -40,6 +46,39 @@ createWRMPartition(Teuchos::ParameterList& plist) {
 }
 
 
+void
+WRMRegionBatches::Initialize(const Functions::MeshPartition& part, int ncells) {
+  int nregions = 0;
+  for (int c=0; c!=ncells; ++c) nregions = std::max(nregions, part[c]+1);
+
+  region_cells_.clear();
+  region_cells_.resize(nregions);
+  for (int c=0; c!=ncells; ++c) {
+    AMANZI_ASSERT(part[c] >= 0);
+    region_cells_[part[c]].push_back(c);
+  }
+
+  std::size_t max_size = 0;
+  for (const auto& cells : region_cells_) max_size = std::max(max_size, cells.size());
+  in_buf_.resize(max_size);
+  out_buf_.resize(max_size);
+}
+
+
+void
+WRMRegionBatches::Evaluate(const WRMList& wrms, WRMBatchFn f,
+                           const double* in, double* out) {
+  AMANZI_ASSERT(region_cells_.size() <= wrms.size());
+  for (int r=0; r!=region_cells_.size(); ++r) {
+    const std::vector<int>& cells = region_cells_[r];
+    int n = cells.size();
+    for (int i=0; i!=n; ++i) in_buf_[i] = in[cells[i]];
+    ((*wrms[r]).*f)(in_buf_.data(), out_buf_.data(), n);
+    for (int i=0; i!=n; ++i) out[cells[i]] = out_buf_[i];
+  }
+}
+
+
 // Non-member factory
 Teuchos::RCP<WRMPermafrostModelPartition>
 createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
@@ -18,6 +18,8 @@ A list of (region, WRM) pairs, where the regions partition the mesh.
 * `"region`" ``[string]`` Region on which the WRM is valid.
 * `"WRM type`" ``[string]`` Name of the WRM type.
 * `"_WRM_type_ parameters`" ``[_WRM_type_-spec]`` Spec for parameters of the requested type.
+* `"use lookup table`" ``[bool]`` **false** Evaluate the WRM from tables, see
+  ``[wrm-lookup-table-spec]``.
 
 */
 
@@ -41,6 +43,26 @@ typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, WRMPermafrostModelList
 Teuchos::RCP<WRMPartition>
 createWRMPartition(Teuchos::ParameterList& plist);
 
+
+// Per-region lists of cells in a partition.  Rather than dispatching to the
+// WRM of each cell in turn, values are gathered a region at a time into
+// contiguous buffers and evaluated with the WRM's batched interface.
+typedef void(WRM::*WRMBatchFn)(const double* in, double* out, int n);
+
+class WRMRegionBatches {
+ public:
+  // Builds the lists for the first ncells cells of an initialized partition.
+  void Initialize(const Functions::MeshPartition& part, int ncells);
+  bool initialized() const { return region_cells_.size() > 0; }
+
+  // out[c] = (wrm_of_c->*f)(in[c]) for all cells c.
+  void Evaluate(const WRMList& wrms, WRMBatchFn f, const double* in, double* out);
+
+ private:
+  std::vector<std::vector<int> > region_cells_;
+  std::vector<double> in_buf_, out_buf_;
+};
+
 Teuchos::RCP<WRMPermafrostModelPartition>
 createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
         Teuchos::RCP<WRMPartition>& wrms);
@@ -0,0 +1,219 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! WRMTabulated : a lookup-table cache of another WRM.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "errors.hh"
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+WRMTabulated::WRMTabulated(Teuchos::ParameterList& plist, const Teuchos::RCP<WRM>& wrm) :
+    wrm_(wrm)
+{
+  tol_ = plist.get<double>("lookup table tolerance", 1.e-8);
+  max_size_ = plist.get<int>("lookup table maximum size", 100000);
+  double pc_max = plist.get<double>("lookup table maximum capillary pressure [Pa]", 1.e7);
+  if (tol_ <= 0. || pc_max <= 0. || max_size_ < 2) {
+    Errors::Message msg("WRM lookup table: tolerance, maximum capillary pressure, and maximum size must be positive.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // saturation varies over decades of capillary pressure, so start from a
+  // logarithmically spaced set of nodes
+  std::vector<double> pc_nodes(1, 0.);
+  for (double pc=1.; pc < pc_max; pc *= 10.) pc_nodes.push_back(pc);
+  pc_nodes.push_back(pc_max);
+  Fit_([this](double pc) { return wrm_->saturation(pc); },
+       [this](double pc) { return wrm_->d_saturation(pc); },
+       pc_nodes, sat_table_);
+
+  // relative permeability, on [sr, 1]
+  double sr = wrm_->residualSaturation();
+  int n_s = 16;
+  std::vector<double> s_nodes(n_s+1);
+  for (int i=0; i!=n_s+1; ++i) s_nodes[i] = sr + (1.0 - sr) * i / n_s;
+  Fit_([this](double s) { return wrm_->k_relative(s); },
+       [this](double s) { return wrm_->d_k_relative(s); },
+       s_nodes, kr_table_);
+}
+
+
+double WRMTabulated::k_relative(double s) {
+  int i = kr_table_.Find(s);
+  if (i < 0 || kr_table_.exact[i]) return wrm_->k_relative(s);
+  return kr_table_.Value(i, s);
+}
+
+
+double WRMTabulated::d_k_relative(double s) {
+  int i = kr_table_.Find(s);
+  if (i < 0 || kr_table_.exact[i]) return wrm_->d_k_relative(s);
+  return kr_table_.Derivative(i, s);
+}
+
+
+double WRMTabulated::saturation(double pc) {
+  int i = sat_table_.Find(pc);
+  if (i < 0 || sat_table_.exact[i]) return wrm_->saturation(pc);
+  return sat_table_.Value(i, pc);
+}
+
+
+double WRMTabulated::d_saturation(double pc) {
+  int i = sat_table_.Find(pc);
+  if (i < 0 || sat_table_.exact[i]) return wrm_->d_saturation(pc);
+  return sat_table_.Derivative(i, pc);
+}
+
+
+// batched versions
+void WRMTabulated::saturation_batch(const double* pc, double* s, int n) {
+  for (int i=0; i!=n; ++i) s[i] = WRMTabulated::saturation(pc[i]);
+}
+
+
+void WRMTabulated::d_saturation_batch(const double* pc, double* ds, int n) {
+  for (int i=0; i!=n; ++i) ds[i] = WRMTabulated::d_saturation(pc[i]);
+}
+
+
+void WRMTabulated::k_relative_batch(const double* s, double* kr, int n) {
+  for (int i=0; i!=n; ++i) kr[i] = WRMTabulated::k_relative(s[i]);
+}
+
+
+void WRMTabulated::d_k_relative_batch(const double* s, double* dkr, int n) {
+  for (int i=0; i!=n; ++i) dkr[i] = WRMTabulated::d_k_relative(s[i]);
+}
+
+
+/* ******************************************************************
+ * Builds a table by bisecting each of the initial intervals until the
+ * interpolant is within tolerance.
+ ****************************************************************** */
+void WRMTabulated::Fit_(const std::function<double(double)>& f,
+                        const std::function<double(double)>& df,
+                        const std::vector<double>& initial_nodes,
+                        Table_& table) const
+{
+  double min_width = 1.e-10 * (initial_nodes.back() - initial_nodes.front());
+
+  double x0 = initial_nodes[0];
+  double y0 = f(x0);
+  double dy0 = df(x0);
+  table.x.push_back(x0);
+  table.y.push_back(y0);
+
+  for (int i=1; i!=(int) initial_nodes.size(); ++i) {
+    double x1 = initial_nodes[i];
+    double y1 = f(x1);
+    double dy1 = df(x1);
+    Refine_(f, df, x0, y0, dy0, x1, y1, dy1, min_width, table);
+    x0 = x1; y0 = y1; dy0 = dy1;
+  }
+}
+
+
+void WRMTabulated::Refine_(const std::function<double(double)>& f,
+                           const std::function<double(double)>& df,
+                           double x0, double y0, double dy0,
+                           double x1, double y1, double dy1,
+                           double min_width, Table_& table) const
+{
+  // Fritsch-Carlson limiting of the end slopes keeps the cubic monotone
+  double delta = (y1 - y0) / (x1 - x0);
+  double dyl = dy0;
+  double dyr = dy1;
+  if (delta == 0.) {
+    dyl = 0.;
+    dyr = 0.;
+  } else {
+    double alpha = dyl / delta;
+    double beta = dyr / delta;
+    if (alpha < 0.) { dyl = 0.; alpha = 0.; }
+    if (beta < 0.) { dyr = 0.; beta = 0.; }
+    double r2 = alpha*alpha + beta*beta;
+    if (r2 > 9.) {
+      double tau = 3. / std::sqrt(r2);
+      dyl = tau * alpha * delta;
+      dyr = tau * beta * delta;
+    }
+  }
+
+  // check the interpolant at interior points
+  Table_ interval;
+  interval.x = { x0, x1 };
+  interval.y = { y0, y1 };
+  interval.dy_left = { dyl };
+  interval.dy_right = { dyr };
+
+  bool converged = true;
+  for (double t : { 0.25, 0.5, 0.75 }) {
+    double xi = x0 + t * (x1 - x0);
+    if (std::abs(interval.Value(0, xi) - f(xi)) > tol_) {
+      converged = false;
+      break;
+    }
+  }
+
+  if (!converged && (x1 - x0) > min_width && (int) table.x.size() < max_size_) {
+    double xm = 0.5 * (x0 + x1);
+    double ym = f(xm);
+    double dym = df(xm);
+    Refine_(f, df, x0, y0, dy0, xm, ym, dym, min_width, table);
+    Refine_(f, df, xm, ym, dym, x1, y1, dy1, min_width, table);
+    return;
+  }
+
+  table.x.push_back(x1);
+  table.y.push_back(y1);
+  table.dy_left.push_back(dyl);
+  table.dy_right.push_back(dyr);
+  table.exact.push_back(!converged);
+}
+
+
+int WRMTabulated::Table_::Find(double xi) const
+{
+  if (!(xi >= x.front() && xi <= x.back())) return -1;
+  int i = std::upper_bound(x.begin(), x.end(), xi) - x.begin() - 1;
+  return std::min<int>(i, x.size() - 2);
+}
+
+
+double WRMTabulated::Table_::Value(int i, double xi) const
+{
+  double h = x[i+1] - x[i];
+  double t = (xi - x[i]) / h;
+  double t2 = t*t;
+  double t3 = t2*t;
+  return (2*t3 - 3*t2 + 1) * y[i]
+      + (t3 - 2*t2 + t) * h * dy_left[i]
+      + (-2*t3 + 3*t2) * y[i+1]
+      + (t3 - t2) * h * dy_right[i];
+}
+
+
+double WRMTabulated::Table_::Derivative(int i, double xi) const
+{
+  double h = x[i+1] - x[i];
+  double t = (xi - x[i]) / h;
+  double t2 = t*t;
+  return ((6*t2 - 6*t) * (y[i] - y[i+1])) / h
+      + (3*t2 - 4*t + 1) * dy_left[i]
+      + (3*t2 - 2*t) * dy_right[i];
+}
+
+} //namespace
+} //namespace
@@ -0,0 +1,125 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! WRMTabulated : a lookup-table cache of another WRM.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Evaluating a WRM such as van Genuchten's costs several calls to ``pow`` per
+cell for each of saturation, relative permeability, and their derivatives.
+When `"use lookup table`" is true in a WRM's region list, the WRM is wrapped
+by this class, which tabulates saturation as a function of capillary
+pressure and relative permeability as a function of saturation once, at
+construction, and evaluates both from the tables thereafter.
+
+Tables are piecewise cubic Hermite interpolants through the exact values and
+derivatives of the wrapped WRM, with derivatives limited (Fritsch-Carlson) so
+that the interpolant is monotone wherever the WRM is.  Intervals are bisected
+until the interpolant is within the requested tolerance of the WRM at
+interior test points.  Intervals that cannot meet the tolerance before
+reaching a minimum width (e.g. near a singular derivative) are evaluated with
+the wrapped WRM instead, as are arguments outside of the tabulated range.
+Derivatives are the derivatives of the interpolant, so that they are
+consistent with the tabulated values.
+
+Capillary pressure as a function of saturation is not tabulated and is
+always evaluated with the wrapped WRM.
+
+Because permafrost WRMs evaluate their underlying WRM, they use the tables
+as well.
+
+.. _wrm-lookup-table-spec
+.. admonition:: wrm-lookup-table-spec
+
+    * `"use lookup table`" ``[bool]`` **false** Tabulate this WRM.
+    * `"lookup table tolerance`" ``[double]`` **1.e-8** Maximum absolute error
+      in saturation and relative permeability.
+    * `"lookup table maximum capillary pressure [Pa]`" ``[double]`` **1.e7**
+      Saturation is tabulated on [0, this value].
+    * `"lookup table maximum size`" ``[int]`` **100000** Maximum number of
+      nodes in each table.
+
+*/
+
+#ifndef ATS_FLOWRELATIONS_WRM_TABULATED_
+#define ATS_FLOWRELATIONS_WRM_TABULATED_
+
+#include <functional>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "wrm.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class WRMTabulated : public WRM {
+
+public:
+  WRMTabulated(Teuchos::ParameterList& plist, const Teuchos::RCP<WRM>& wrm);
+
+  // required methods from the base class
+  double k_relative(double saturation);
+  double d_k_relative(double saturation);
+  double saturation(double pc);
+  double d_saturation(double pc);
+  double capillaryPressure(double saturation) { return wrm_->capillaryPressure(saturation); }
+  double d_capillaryPressure(double saturation) { return wrm_->d_capillaryPressure(saturation); }
+  double residualSaturation() { return wrm_->residualSaturation(); }
+
+  // batched versions, without a virtual call per value
+  void saturation_batch(const double* pc, double* s, int n);
+  void d_saturation_batch(const double* pc, double* ds, int n);
+  void k_relative_batch(const double* s, double* kr, int n);
+  void d_k_relative_batch(const double* s, double* dkr, int n);
+
+  int size_saturation() const { return sat_table_.x.size(); }
+  int size_k_relative() const { return kr_table_.x.size(); }
+
+ private:
+  // A monotone piecewise cubic Hermite table on nodes x.  Slopes are stored
+  // per interval, as limiting may change them on one side of a node only.
+  // Intervals with exact[i] set fall back to the wrapped WRM.
+  struct Table_ {
+    std::vector<double> x, y;
+    std::vector<double> dy_left, dy_right;
+    std::vector<bool> exact;
+
+    // returns the interval containing xi, or -1 if outside of the table
+    int Find(double xi) const;
+    double Value(int i, double xi) const;
+    double Derivative(int i, double xi) const;
+  };
+
+  void Fit_(const std::function<double(double)>& f,
+            const std::function<double(double)>& df,
+            const std::vector<double>& initial_nodes,
+            Table_& table) const;
+  void Refine_(const std::function<double(double)>& f,
+               const std::function<double(double)>& df,
+               double x0, double y0, double dy0,
+               double x1, double y1, double dy1,
+               double min_width, Table_& table) const;
+
+ private:
+  Teuchos::RCP<WRM> wrm_;
+
+  double tol_;
+  int max_size_;
+
+  Table_ sat_table_;
+  Table_ kr_table_;
+};
+
+} //namespace
+} //namespace
+
+#endif
@@ -132,6 +132,27 @@ double WRMVanGenuchten::d_capillaryPressure(double s) {
 }
 
 
+/* ******************************************************************
+ * Batched versions.  Qualified calls avoid virtual dispatch and allow
+ * inlining.
+ ****************************************************************** */
+void WRMVanGenuchten::saturation_batch(const double* pc, double* s, int n) {
+  for (int i=0; i!=n; ++i) s[i] = WRMVanGenuchten::saturation(pc[i]);
+}
+
+void WRMVanGenuchten::d_saturation_batch(const double* pc, double* ds, int n) {
+  for (int i=0; i!=n; ++i) ds[i] = WRMVanGenuchten::d_saturation(pc[i]);
+}
+
+void WRMVanGenuchten::k_relative_batch(const double* s, double* kr, int n) {
+  for (int i=0; i!=n; ++i) kr[i] = WRMVanGenuchten::k_relative(s[i]);
+}
+
+void WRMVanGenuchten::d_k_relative_batch(const double* s, double* dkr, int n) {
+  for (int i=0; i!=n; ++i) dkr[i] = WRMVanGenuchten::d_k_relative(s[i]);
+}
+
+
 void WRMVanGenuchten::InitializeFromPlist_() {
   std::string fname = plist_.get<std::string>("Krel function name", "Mualem");
   if (fname == std::string("Mualem")) {
@@ -70,6 +70,12 @@ public:
   double d_capillaryPressure(double saturation);
   double residualSaturation() { return sr_; }
 
+  // batched versions, without a virtual call per value
+  void saturation_batch(const double* pc, double* s, int n);
+  void d_saturation_batch(const double* pc, double* ds, int n);
+  void k_relative_batch(const double* s, double* kr, int n);
+  void d_k_relative_batch(const double* s, double* dkr, int n);
+
  private:
   void InitializeFromPlist_();
 
@@ -0,0 +1,349 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Steady-state fill-and-spill of a volume over a cell graph.
+
+#include <algorithm>
+#include <numeric>
+
+#include "Epetra_Util.h"
+
+#include "fill_and_spill.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+FillAndSpill::FillAndSpill(const AmanziMesh::Mesh& mesh)
+{
+  const Epetra_Map& cell_map = mesh.cell_map(false);
+  int ncells = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  AmanziMesh::Entity_ID_List adj_cells;
+
+  if (cell_map.Comm().NumProc() == 1) {
+    offsets_.resize(ncells+1, 0);
+    for (int c=0; c!=ncells; ++c) {
+      mesh.cell_get_face_adj_cells(c, AmanziMesh::Parallel_type::OWNED, &adj_cells);
+      for (auto nc : adj_cells) {
+        if (nc < ncells) nbrs_.push_back(nc);
+      }
+      offsets_[c+1] = nbrs_.size();
+    }
+    return;
+  }
+
+  // Gather the global IDs of each cell's neighbors, including ghosts, onto
+  // process 0, padded to the largest number of neighbors with -1.
+  root_map_ = Teuchos::rcp(new Epetra_Map(Epetra_Util::Create_Root_Map(cell_map, 0)));
+  root_importer_ = Teuchos::rcp(new Epetra_Import(*root_map_, cell_map));
+
+  const Epetra_Map& cell_map_ghosted = mesh.cell_map(true);
+  int max_nbrs_l = 0;
+  for (int c=0; c!=ncells; ++c) {
+    mesh.cell_get_face_adj_cells(c, AmanziMesh::Parallel_type::ALL, &adj_cells);
+    max_nbrs_l = std::max(max_nbrs_l, (int) adj_cells.size());
+  }
+  int max_nbrs = 0;
+  cell_map.Comm().MaxAll(&max_nbrs_l, &max_nbrs, 1);
+  if (max_nbrs == 0) max_nbrs = 1;
+
+  Epetra_MultiVector nbr_gids(cell_map, max_nbrs);
+  nbr_gids.PutScalar(-1.);
+  for (int c=0; c!=ncells; ++c) {
+    mesh.cell_get_face_adj_cells(c, AmanziMesh::Parallel_type::ALL, &adj_cells);
+    for (int i=0; i!=(int) adj_cells.size(); ++i) {
+      nbr_gids[i][c] = cell_map_ghosted.GID(adj_cells[i]);
+    }
+  }
+
+  Epetra_MultiVector nbr_gids_root(*root_map_, max_nbrs);
+  nbr_gids_root.Import(nbr_gids, *root_importer_, Insert);
+
+  int ncells_root = root_map_->NumMyElements();
+  offsets_.resize(ncells_root+1, 0);
+  for (int c=0; c!=ncells_root; ++c) {
+    for (int i=0; i!=max_nbrs; ++i) {
+      int gid = (int) nbr_gids_root[i][c];
+      if (gid >= 0) nbrs_.push_back(root_map_->LID(gid));
+    }
+    offsets_[c+1] = nbrs_.size();
+  }
+}
+
+
+FillAndSpill::FillAndSpill(const std::vector<int>& offsets, const std::vector<int>& nbrs) :
+    offsets_(offsets),
+    nbrs_(nbrs) {}
+
+
+void
+FillAndSpill::Distribute(const double* base, const double* area, const double* volume,
+                         double* depth) const
+{
+  int ncells = num_cells();
+  std::fill(depth, depth+ncells, 0.);
+  if (ncells == 0) return;
+
+  auto lower = [base](int a, int b) {
+    return base[a] < base[b] || (base[a] == base[b] && a < b);
+  };
+
+  std::vector<int> order(ncells);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), lower);
+
+  // Sweep cells from lowest to highest, building the merge tree.  Processed
+  // cells are kept in a union-find of connected regions; the representative
+  // of each region knows its current tree node.
+  std::vector<int> uf(ncells, -1); // -1 marks unprocessed cells
+  std::vector<int> node_of(ncells, -1);
+  std::vector<int> leaf_of(ncells, -1); // pit each cell drains to
+  auto find = [&uf](int c) {
+    while (uf[c] != c) {
+      uf[c] = uf[uf[c]];
+      c = uf[c];
+    }
+    return c;
+  };
+
+  std::vector<Node_> nodes;
+  std::vector<int> regions;  // distinct regions adjacent to a cell
+  std::vector<int> lowest;   // lowest neighbor of the cell in each region
+  for (int c : order) {
+    regions.clear();
+    lowest.clear();
+    int drain = -1;
+    for (int i=offsets_[c]; i!=offsets_[c+1]; ++i) {
+      int nc = nbrs_[i];
+      if (uf[nc] < 0) continue;
+      if (drain < 0 || lower(nc, drain)) drain = nc;
+
+      int r = find(nc);
+      auto it = std::find(regions.begin(), regions.end(), r);
+      if (it == regions.end()) {
+        regions.push_back(r);
+        lowest.push_back(nc);
+      } else {
+        int& l = lowest[it - regions.begin()];
+        if (lower(nc, l)) l = nc;
+      }
+    }
+
+    int n;
+    if (regions.empty()) {
+      // a pit
+      n = nodes.size();
+      nodes.emplace_back(base[c]);
+      leaf_of[c] = n;
+    } else if (regions.size() == 1) {
+      n = node_of[regions[0]];
+      leaf_of[c] = leaf_of[drain];
+    } else {
+      // a saddle, where two or more depressions meet
+      n = nodes.size();
+      nodes.emplace_back(base[c]);
+      for (int i=0; i!=(int) regions.size(); ++i) {
+        int child = node_of[regions[i]];
+        nodes[child].parent = n;
+        nodes[child].entry_leaf = leaf_of[lowest[i]];
+        nodes[n].children.push_back(child);
+      }
+      leaf_of[c] = leaf_of[drain];
+    }
+
+    uf[c] = c;
+    for (int r : regions) uf[r] = c;
+    node_of[c] = n;
+
+    Node_& node = nodes[n];
+    node.cells.push_back(c);
+    node.area += area[c];
+    node.sum_ab += area[c] * base[c];
+    nodes[leaf_of[c]].volume += volume[c];
+  }
+
+  // Children are created before their parents, so accumulating in order of
+  // creation sums each region over its subtree.
+  int nnodes = nodes.size();
+  for (int n=0; n!=nnodes; ++n) {
+    int p = nodes[n].parent;
+    if (p >= 0) {
+      nodes[p].area += nodes[n].area;
+      nodes[p].sum_ab += nodes[n].sum_ab;
+      nodes[p].volume += nodes[n].volume;
+    }
+  }
+
+  // Number the tree depth-first so that subtree membership is an interval test.
+  std::vector<int> roots;
+  for (int n=0; n!=nnodes; ++n) {
+    if (nodes[n].parent < 0) roots.push_back(n);
+  }
+  {
+    int count = 0;
+    std::vector<std::pair<int,int> > stack;
+    for (int root : roots) {
+      nodes[root].tin = count++;
+      stack.emplace_back(root, 0);
+      while (!stack.empty()) {
+        int n = stack.back().first;
+        int i = stack.back().second;
+        if (i < (int) nodes[n].children.size()) {
+          stack.back().second++;
+          int child = nodes[n].children[i];
+          nodes[child].tin = count++;
+          stack.emplace_back(child, 0);
+        } else {
+          nodes[n].tout = count;
+          stack.pop_back();
+        }
+      }
+    }
+  }
+
+  // Distribute volume from the roots down.  The boundary is closed, so each
+  // root holds everything that drains into it.
+  struct Task {
+    int node;
+    double volume;
+    std::vector<Inflow_> inflows;
+  };
+  std::vector<Task> tasks;
+  for (int root : roots) tasks.push_back(Task{root, nodes[root].volume, {}});
+
+  while (!tasks.empty()) {
+    Task task = std::move(tasks.back());
+    tasks.pop_back();
+    const Node_& node = nodes[task.node];
+
+    if (node.children.empty()) {
+      Fill_(nodes, task.node, task.volume, base, area, depth);
+      continue;
+    }
+
+    // Enough volume to fill all sub-depressions to the saddle forms one lake.
+    int nchildren = node.children.size();
+    std::vector<double> cap(nchildren), vol(nchildren);
+    double total_cap = 0.;
+    for (int i=0; i!=nchildren; ++i) {
+      const Node_& child = nodes[node.children[i]];
+      cap[i] = Capacity_(child, node.z);
+      vol[i] = child.volume;
+      total_cap += cap[i];
+    }
+    if (task.volume >= total_cap) {
+      Fill_(nodes, task.node, task.volume, base, area, depth);
+      continue;
+    }
+
+    // Otherwise each sub-depression keeps what drains into it, including
+    // volume spilled into this region from outside ...
+    std::vector<std::vector<Inflow_> > inflows(nchildren);
+    for (const auto& inflow : task.inflows) {
+      int tin = nodes[inflow.leaf].tin;
+      for (int i=0; i!=nchildren; ++i) {
+        const Node_& child = nodes[node.children[i]];
+        if (child.tin <= tin && tin < child.tout) {
+          vol[i] += inflow.volume;
+          inflows[i].push_back(inflow);
+          break;
+        }
+      }
+    }
+
+    // ... and full sub-depressions spill over the saddle into the
+    // sub-depression with room whose pit is lowest.
+    bool lake = false;
+    for (bool spilled=true; spilled && !lake; ) {
+      spilled = false;
+      for (int i=0; i!=nchildren; ++i) {
+        if (vol[i] <= cap[i]) continue;
+
+        int j = -1;
+        for (int k=0; k!=nchildren; ++k) {
+          if (vol[k] < cap[k] &&
+              (j < 0 || nodes[nodes[node.children[k]].entry_leaf].z
+               < nodes[nodes[node.children[j]].entry_leaf].z)) j = k;
+        }
+        if (j < 0) {
+          // only possible through round-off in total_cap
+          lake = true;
+          break;
+        }
+
+        double excess = vol[i] - cap[i];
+        vol[i] = cap[i];
+        vol[j] += excess;
+        inflows[j].push_back(Inflow_{nodes[node.children[j]].entry_leaf, excess});
+        spilled = true;
+      }
+    }
+
+    if (lake) {
+      Fill_(nodes, task.node, task.volume, base, area, depth);
+    } else {
+      for (int i=0; i!=nchildren; ++i) {
+        tasks.push_back(Task{node.children[i], vol[i], std::move(inflows[i])});
+      }
+    }
+  }
+}
+
+
+void
+FillAndSpill::Distribute(const Epetra_MultiVector& base, const Epetra_MultiVector& area,
+                         const Epetra_MultiVector& volume, Epetra_MultiVector& depth) const
+{
+  if (root_importer_ == Teuchos::null) {
+    Distribute(base[0], area[0], volume[0], depth[0]);
+    return;
+  }
+
+  Epetra_MultiVector base_root(*root_map_, 1);
+  Epetra_MultiVector area_root(*root_map_, 1);
+  Epetra_MultiVector volume_root(*root_map_, 1);
+  Epetra_MultiVector depth_root(*root_map_, 1);
+  base_root.Import(base, *root_importer_, Insert);
+  area_root.Import(area, *root_importer_, Insert);
+  volume_root.Import(volume, *root_importer_, Insert);
+
+  Distribute(base_root[0], area_root[0], volume_root[0], depth_root[0]);
+  depth.Export(depth_root, *root_importer_, Insert);
+}
+
+
+void
+FillAndSpill::Fill_(const std::vector<Node_>& nodes, int n, double volume,
+                    const double* base, const double* area, double* depth) const
+{
+  std::vector<int> cells;
+  std::vector<int> stack(1, n);
+  while (!stack.empty()) {
+    const Node_& node = nodes[stack.back()];
+    stack.pop_back();
+    cells.insert(cells.end(), node.cells.begin(), node.cells.end());
+    stack.insert(stack.end(), node.children.begin(), node.children.end());
+  }
+  std::sort(cells.begin(), cells.end(), [base](int a, int b) {
+      return base[a] < base[b] || (base[a] == base[b] && a < b); });
+
+  // raise the level over the lowest cells until it holds the volume
+  double lake_area = 0.;
+  double lake_sum_ab = 0.;
+  double level = base[cells[0]];
+  for (int i=0; i!=(int) cells.size(); ++i) {
+    int c = cells[i];
+    lake_area += area[c];
+    lake_sum_ab += area[c] * base[c];
+    level = (volume + lake_sum_ab) / lake_area;
+    if (i+1 == (int) cells.size() || level <= base[cells[i+1]]) break;
+  }
+
+  for (int c : cells) depth[c] = std::max(level - base[c], 0.);
+}
+
+} // namespace
+} // namespace
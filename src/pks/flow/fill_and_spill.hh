@@ -0,0 +1,110 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Steady-state fill-and-spill of a volume over a cell graph.
+
+/*!
+
+Given a base surface elevation on each cell and a volume deposited on each
+cell, computes the depth on each cell after all volume has run downhill,
+filled depressions, and spilled over their rims into neighboring depressions.
+The boundary of the graph is closed, so volume is conserved.
+
+Cells are swept once in order of increasing elevation (a priority flood),
+building the merge tree of depressions: leaves are pits, and an internal node
+is created at each saddle where two or more depressions meet.  Each cell's
+volume drains along steepest descent to a pit.  The tree is then traversed
+from its roots: a depression holding at least the volume needed to fill all of
+its sub-depressions to the saddle forms a single lake, while otherwise each
+sub-depression keeps its own volume and spills anything beyond its capacity
+at the saddle into its neighbors.  The total cost is O(N log N).
+
+The graph is given as the cells of a mesh and their face neighbors.  The sweep
+is inherently serial, so in parallel the graph is gathered once, at
+construction, onto process 0, and on each call the cell fields are gathered
+there, distributed over the whole mesh, and the depth scattered back.  Results
+are therefore independent of the partitioning, but the sweep does not scale
+with the number of processes.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_Import.h"
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class FillAndSpill {
+ public:
+  // Graph of the mesh's cells connected through faces, gathered onto
+  // process 0 in parallel.
+  explicit FillAndSpill(const AmanziMesh::Mesh& mesh);
+
+  // Neighbors of cell c are nbrs[offsets[c]:offsets[c+1]].
+  FillAndSpill(const std::vector<int>& offsets, const std::vector<int>& nbrs);
+
+  // Given base elevation, area, and deposited volume on each cell, compute
+  // the resulting depth on each cell.
+  void Distribute(const double* base, const double* area, const double* volume,
+                  double* depth) const;
+
+  // As above, for fields on the owned cells of the mesh.  In parallel, these
+  // are gathered onto process 0 and the depth is scattered back.
+  void Distribute(const Epetra_MultiVector& base, const Epetra_MultiVector& area,
+                  const Epetra_MultiVector& volume, Epetra_MultiVector& depth) const;
+
+  int num_cells() const { return offsets_.size() - 1; }
+
+ private:
+  struct Node_ {
+    Node_(double z_) :
+        z(z_), area(0.), sum_ab(0.), volume(0.), parent(-1), entry_leaf(-1),
+        tin(0), tout(0) {}
+
+    double z;                   // elevation of the pit or saddle
+    double area;                // area of the cells in the region
+    double sum_ab;              // sum of area * base over the region
+    double volume;              // volume draining into the region
+    int parent;
+    int entry_leaf;             // leaf receiving volume spilled into this region
+    int tin, tout;              // leaves of the subtree have tin in [tin, tout)
+    std::vector<int> children;
+    std::vector<int> cells;     // cells added to this node, not to its children
+  };
+
+  // Volume that enters a region, and the leaf it drains to.
+  struct Inflow_ {
+    int leaf;
+    double volume;
+  };
+
+  // capacity of the region of node n when filled to z
+  static double Capacity_(const Node_& n, double z) { return z * n.area - n.sum_ab; }
+
+  // fill the region of node n with volume as a single lake
+  void Fill_(const std::vector<Node_>& nodes, int n, double volume,
+             const double* base, const double* area, double* depth) const;
+
+ private:
+  std::vector<int> offsets_;
+  std::vector<int> nbrs_;
+
+  // non-null in parallel, where the graph lives on process 0
+  Teuchos::RCP<Epetra_Map> root_map_;
+  Teuchos::RCP<Epetra_Import> root_importer_;
+};
+
+} // namespace
+} // namespace
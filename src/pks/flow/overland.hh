@@ -66,8 +66,8 @@ public:
   // updates the preconditioner
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
-  // -- Compute a norm on u-du and return the result.
-  virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
+  // -- Compute a norm on u-du on this process and return the result.
+  virtual double ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du);
   
 protected:
@@ -229,6 +229,7 @@ protected:
   void AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g);
   // -- source terms
   void AddSourceTerms_(const Teuchos::Ptr<CompositeVector>& g);
+  virtual void AddSourcesToPrecon_(const Teuchos::Ptr<State>& S, double h);
 
   void test_ApplyPreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
@@ -270,6 +271,7 @@ protected:
   bool is_source_term_;
   bool source_in_meters_;
   bool source_only_if_unfrozen_;
+  bool source_term_is_differentiable_;
 
   bool modify_predictor_with_consistent_faces_;
   bool symmetric_;
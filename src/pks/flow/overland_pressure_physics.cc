@@ -132,5 +132,55 @@ void OverlandPressureFlow::AddSourceTerms_(const Teuchos::Ptr<CompositeVector>&
 };
 
 
+// -------------------------------------------------------------
+// Source term derivatives
+// -------------------------------------------------------------
+void OverlandPressureFlow::AddSourcesToPrecon_(const Teuchos::Ptr<State>& S, double h)
+{
+  // external sources of water (pressure dependent source, e.g. the surface
+  // energy balance)
+  if (is_source_term_ && source_term_is_differentiable_ &&
+      S->GetFieldEvaluator(source_key_)->IsDependency(S, key_)) {
+
+    S->GetFieldEvaluator(source_key_)->HasFieldDerivativeChanged(S, name_, key_);
+    Key dsource_dp_key = Keys::getDerivKey(source_key_, key_);
+    const Epetra_MultiVector& dq_dp = *S->GetFieldData(dsource_dp_key)
+        ->ViewComponent("cell",false);
+
+    // the preconditioner is in h coordinates, see UpdatePreconditioner()
+    const Epetra_MultiVector& dh_dp = *S->GetFieldData(Keys::getDerivKey(pd_bar_key_, key_))
+        ->ViewComponent("cell",false);
+    const Epetra_MultiVector& cv =
+        *S->GetFieldData(cv_key_)->ViewComponent("cell",false);
+
+    CompositeVector acc(S->GetFieldData(dsource_dp_key)->Map());
+    Epetra_MultiVector& acc_c = *acc.ViewComponent("cell", false);
+    int ncells = acc_c.MyLength();
+
+    if (source_in_meters_) {
+      // External source term is in [m water / s], not in [mols / s], so a
+      // density is required, upwinded as in AddSourceTerms_().
+      const Epetra_MultiVector& q = *S->GetFieldData(source_key_)
+          ->ViewComponent("cell",false);
+      const Epetra_MultiVector& nliq1 = *S->GetFieldData(molar_dens_key_)
+          ->ViewComponent("cell",false);
+      const Epetra_MultiVector& nliq1_s = *S->GetFieldData(source_molar_dens_key_)
+          ->ViewComponent("cell",false);
+      for (int c=0; c!=ncells; ++c) {
+        double n = q[0][c] > 0. ? nliq1_s[0][c] : nliq1[0][c];
+        acc_c[0][c] = -cv[0][c] * dq_dp[0][c] * n / dh_dp[0][c];
+      }
+    } else {
+      for (int c=0; c!=ncells; ++c) {
+        acc_c[0][c] = -cv[0][c] * dq_dp[0][c] / dh_dp[0][c];
+      }
+    }
+
+    db_->WriteVector("  dQ_ext/dp", S->GetFieldData(dsource_dp_key).ptr(), false);
+    preconditioner_acc_->AddAccumulationTerm(acc, "cell");
+  }
+}
+
+
 } //namespace
 } //namespace
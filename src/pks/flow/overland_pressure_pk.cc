@@ -49,6 +49,7 @@ OverlandPressureFlow::OverlandPressureFlow(Teuchos::ParameterList& pk_tree,
     update_flux_(UPDATE_FLUX_ITERATION),
     niter_(0),
     source_only_if_unfrozen_(false),
+    source_term_is_differentiable_(true),
     precon_used_(true),
     precon_scaled_(false),
     jacobian_(false),
@@ -328,6 +329,8 @@ void OverlandPressureFlow::SetupPhysicalEvaluators_(const Teuchos::Ptr<State>& S
       source_key_ = Keys::readKey(*plist_, domain_, "source", "mass_source");
     }
     source_in_meters_ = plist_->get<bool>("mass source in meters", true);
+    source_term_is_differentiable_ =
+        plist_->get<bool>("source term is differentiable", true);
 
     S->RequireField(source_key_)->SetMesh(mesh_)
         ->AddComponent("cell", AmanziMesh::CELL, 1);
@@ -213,7 +213,7 @@ void OverlandFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
 // -----------------------------------------------------------------------------
 // Default enorm that uses an abs and rel tolerance to monitor convergence.
 // -----------------------------------------------------------------------------
-double OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
+double OverlandFlow::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
         Teuchos::RCP<const TreeVector> res) {
   const Epetra_MultiVector& pd = *S_next_->GetFieldData(key_)
       ->ViewComponent("cell",true);
@@ -229,6 +229,7 @@ double OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
   double h = S_next_->time() - S_inter_->time();
 
   double enorm_val = 0.0;
+  std::vector<ENorm_t> enorms;
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
@@ -256,13 +257,14 @@ double OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       const Epetra_MultiVector& kr_f = *S_next_->GetFieldData(Keys::getDerivKey(Keys::getKey(domain_,"upwind_overland_conductivity"), key_))
         ->ViewComponent("face",false);
 
+      const std::vector<int>& face_cells = FaceCells_();
+
       for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ? pd[0][cells[0]] * cv[0][cells[0]]
-            : std::min(pd[0][cells[0]]*cv[0][cells[0]], pd[0][cells[1]]*cv[0][cells[1]]);
+        int c0 = face_cells[2*f];
+        int c1 = face_cells[2*f+1];
+        double cv_min = c1 < 0 ? cv[0][c0] : std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = c1 < 0 ? pd[0][c0] * cv[0][c0]
+            : std::min(pd[0][c0]*cv[0][c0], pd[0][c1]*cv[0][c1]);
       
         double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) 
             / (atol_*cv_min + rtol_*std::abs(conserved_min));
@@ -280,27 +282,15 @@ double OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       Exceptions::amanzi_throw(msg);      
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
-    }
-
+    ENorm_t err;
+    err.value = enorm_comp;
+    err.gid = enorm_loc;
+    enorms.push_back(err);
     enorm_val = std::max(enorm_val, enorm_comp);
   }
 
-  double enorm_val_l = enorm_val;
-  int ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  AMANZI_ASSERT(!ierr);
+  // Write out Inf norms too.
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) WriteErrorNorms_(*dvec, enorms);
   return enorm_val;
 };
 
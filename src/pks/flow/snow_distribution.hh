@@ -34,6 +34,17 @@ daily (which all defaults are set for).
       default to the same as the `"diffusion`" list.  See PDE_Diffusion_.
 
     * `"inverse`" ``[inverse-typed-spec]`` Inverse_ method for the solve.
+
+    * `"distribution method`" ``[string]`` **"diffusion wave"** Either
+      `"diffusion wave`", which integrates the above equation over the
+      distribution time, or `"fill and spill`", which skips the solve and
+      directly routes the precipitated snow downhill into depressions, filling
+      and spilling over the potential (elevation plus ponded depth plus snow
+      depth), as if integrated to steady state.  This conserves the
+      precipitated volume and costs a single sweep of the mesh.  It ignores
+      the conductivity.  The sweep is serial: in parallel the surface is
+      gathered onto one process for it, so it does not scale with the number
+      of processes.
     
     Not typically provided by the user, defaults are good:
 
@@ -60,6 +71,8 @@ daily (which all defaults are set for).
 #include "PK_Factory.hh"
 #include "pk_physical_bdf_default.hh"
 
+#include "fill_and_spill.hh"
+
 namespace Amanzi {
 namespace Flow {
 
@@ -102,7 +115,7 @@ public:
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
   // error monitor
-  virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
+  virtual double ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du);
 
   virtual bool ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
@@ -152,6 +165,9 @@ public:
   // -- accumulation term
   virtual void AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g);
 
+  // direct, steady-state distribution of the mean precip over the big step
+  void DistributeFillAndSpill_(double Ps_mean);
+
  protected:
   // control switches
   Operators::UpwindMethod upwind_method_;
@@ -161,6 +177,9 @@ public:
 
   // function for precip
   Teuchos::RCP<Function> precip_func_;
+
+  // non-null if distributing by fill and spill
+  Teuchos::RCP<FillAndSpill> fill_and_spill_;
   
   // work data space
   Teuchos::RCP<Operators::Upwinding> upwinding_;
@@ -61,6 +61,17 @@ void SnowDistribution::SetupSnowDistribution_(const Teuchos::Ptr<State>& S) {
   FunctionFactory fac;
   precip_func_ = Teuchos::rcp(fac.Create(precip_func));
 
+  // distribution method
+  std::string method = plist_->get<std::string>("distribution method", "diffusion wave");
+  if (method == "fill and spill") {
+    fill_and_spill_ = Teuchos::rcp(new FillAndSpill(*mesh_));
+  } else if (method != "diffusion wave") {
+    Errors::Message message;
+    message << name_ << ": unknown \"distribution method\" \"" << method
+            << "\", valid are \"diffusion wave\" and \"fill and spill\".";
+    Exceptions::amanzi_throw(message);
+  }
+
   // Require fields and evaluators for those fields.
   S->RequireField(key_, name_)->SetMesh(mesh_)->SetGhosted()
       ->SetComponent("cell", AmanziMesh::CELL, 1);
@@ -189,7 +189,7 @@ void SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVec
   preconditioner_diff_->ApplyBCs(true, true, true);
 };
 
-double SnowDistribution::ErrorNorm(Teuchos::RCP<const TreeVector> u,
+double SnowDistribution::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du) {
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -218,21 +218,12 @@ double SnowDistribution::ErrorNorm(Teuchos::RCP<const TreeVector> u,
 
   // Write out Inf norms too.
   if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-    double infnorm_c(0.);
-    res_c.NormInf(&infnorm_c);
-
-    ENorm_t err_c;
-    ENorm_t l_err_c;
-    l_err_c.value = enorm_cell;
-    l_err_c.gid = res_c.Map().GID(bad_cell);
-
-    MPI_Allreduce(&l_err_c, &err_c, 1, MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD);
-
-    *vo_->os() << "ENorm (cells) = " << err_c.value << "[" << err_c.gid << "] (" << infnorm_c << ")" << std::endl;
+    std::vector<ENorm_t> enorms(1);
+    enorms[0].value = enorm_cell;
+    enorms[0].gid = bad_cell;
+    WriteErrorNorms_(*res, enorms);
   }
 
-  double buf = enorm_cell;
-  MPI_Allreduce(&buf, &enorm_cell, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
   return enorm_cell;
 };
 
@@ -284,29 +275,45 @@ SnowDistribution::AdvanceStep(double t_old, double t_new, bool reinit) {
   S_inter_->GetFieldData(key_,name_)->PutScalar(Ps_mean);
   S_next_->GetFieldData(key_,name_)->PutScalar(Ps_mean);
 
-  double my_dt = -1;
-  double my_t_old = t_old;
-  double my_t_new = t_old;
-  while (my_t_old < t_old + dt_factor_) {
-    my_dt = PK_PhysicalBDF_Default::get_dt();
-    my_t_new = std::min(my_t_old + my_dt, t_old + dt_factor_);
-    
-    S_next_->set_time(my_t_new);
-    S_next_->set_last_time(my_t_old);
-    
-    bool failed = PK_PhysicalBDF_Default::AdvanceStep(my_t_old, my_t_new, false);
-
-    if (failed) {
-      *S_next_ = *S_inter_;
-      continue;
+  if (fill_and_spill_ != Teuchos::null) {
+    DistributeFillAndSpill_(Ps_mean);
+    my_next_time_ = t_old + dt_factor_;
+  } else {
+    // Only fields on this PK's domain change in the inner loop, so only those
+    // are copied between S_inter_ and S_next_ on success and failure, rather
+    // than the full (possibly 3D, multi-domain) State.
+    double my_dt = -1;
+    double my_t_old = t_old;
+    double my_t_new = t_old;
+    int nsteps = 0;
+    int nfails = 0;
+    while (my_t_old < t_old + dt_factor_) {
+      my_dt = PK_PhysicalBDF_Default::get_dt();
+      my_t_new = std::min(my_t_old + my_dt, t_old + dt_factor_);
+
+      S_next_->set_time(my_t_new);
+      S_next_->set_last_time(my_t_old);
+
+      bool failed = PK_PhysicalBDF_Default::AdvanceStep(my_t_old, my_t_new, false);
+
+      if (failed) {
+        nfails++;
+        S_next_->AssignDomain(*S_inter_, domain_);
+        continue;
+      }
+
+      nsteps++;
+      PK_PhysicalBDF_Default::CommitStep(my_t_old, my_t_new, S_next_);
+      S_inter_->AssignDomain(*S_next_, domain_);
+      S_inter_->set_time(my_t_new);
+      my_t_old = my_t_new;
     }
 
-    PK_PhysicalBDF_Default::CommitStep(my_t_old, my_t_new, S_next_);
-    *S_inter_ = *S_next_;
-    my_t_old = my_t_new;
+    my_next_time_ = t_old + dt_factor_;
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "BIG STEP took " << nsteps << " inner steps, with " << nfails
+                 << " failed inner steps" << std::endl;
   }
-  
-  my_next_time_ = t_old + dt_factor_;
 
   // commit the precip to the OLD time as well -- this ensures that
   // even if a coupled PK fails at any point in the coming
@@ -324,5 +331,43 @@ SnowDistribution::AdvanceStep(double t_old, double t_new, bool reinit) {
 
 
 
+// -----------------------------------------------------------------------------
+// Route the mean precip of the big step downhill, to steady state, without
+// integrating the diffusion wave.
+// -----------------------------------------------------------------------------
+void
+SnowDistribution::DistributeFillAndSpill_(double Ps_mean) {
+  Key pot_key = Keys::getKey(domain_,"skin_potential");
+  Key cv_key = Keys::getKey(domain_,"cell_volume");
+
+  // the potential without new snow is the surface that new snow fills
+  Teuchos::RCP<CompositeVector> precip = S_next_->GetFieldData(key_,name_);
+  precip->PutScalar(0.);
+  ChangedSolution(S_next_.ptr());
+  S_next_->GetFieldEvaluator(pot_key)->HasFieldChanged(S_next_.ptr(), name_);
+  S_next_->GetFieldEvaluator(cv_key)->HasFieldChanged(S_next_.ptr(), name_);
+  const Epetra_MultiVector& base = *S_next_->GetFieldData(pot_key)->ViewComponent("cell",false);
+  const Epetra_MultiVector& cv = *S_next_->GetFieldData(cv_key)->ViewComponent("cell",false);
+
+  // note 10 is for conversion from precip m SWE to actual m
+  int ncells = base.MyLength();
+  Epetra_MultiVector volume(base.Map(), 1);
+  for (int c=0; c!=ncells; ++c) {
+    volume[0][c] = 10 * dt_factor_ * Ps_mean * cv[0][c];
+  }
+
+  {
+    Epetra_MultiVector& precip_c = *precip->ViewComponent("cell",false);
+    fill_and_spill_->Distribute(base, cv, volume, precip_c);
+    precip_c.Scale(1. / (10 * dt_factor_));
+  }
+  precip->ScatterMasterToGhosted("cell");
+  ChangedSolution(S_next_.ptr());
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH))
+    *vo_->os() << "BIG STEP distributed by fill and spill" << std::endl;
+}
+
+
 }  // namespace Flow
 }  // namespace Amanzi
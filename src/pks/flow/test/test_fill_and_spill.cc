@@ -0,0 +1,172 @@
+#include "UnitTest++.h"
+#include "TestReporterStdout.h"
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "fill_and_spill.hh"
+
+using namespace Amanzi::Flow;
+
+//
+// Checks FillAndSpill on small hand-built cell graphs.
+//
+struct TestGraph {
+  std::vector<int> offsets;
+  std::vector<int> nbrs;
+
+  // a line of n cells
+  static TestGraph Line(int n) {
+    TestGraph g;
+    g.offsets.push_back(0);
+    for (int c=0; c!=n; ++c) {
+      if (c > 0) g.nbrs.push_back(c-1);
+      if (c < n-1) g.nbrs.push_back(c+1);
+      g.offsets.push_back(g.nbrs.size());
+    }
+    return g;
+  }
+
+  // an nx by ny grid of cells, numbered x-fastest
+  static TestGraph Grid(int nx, int ny) {
+    TestGraph g;
+    g.offsets.push_back(0);
+    for (int j=0; j!=ny; ++j) {
+      for (int i=0; i!=nx; ++i) {
+        if (i > 0) g.nbrs.push_back(j*nx + i-1);
+        if (i < nx-1) g.nbrs.push_back(j*nx + i+1);
+        if (j > 0) g.nbrs.push_back((j-1)*nx + i);
+        if (j < ny-1) g.nbrs.push_back((j+1)*nx + i);
+        g.offsets.push_back(g.nbrs.size());
+      }
+    }
+    return g;
+  }
+
+  // cell 0 connected to each of cells 1..n-1, which are connected to nothing
+  // else
+  static TestGraph Star(int n) {
+    TestGraph g;
+    g.offsets.push_back(0);
+    for (int c=1; c!=n; ++c) g.nbrs.push_back(c);
+    g.offsets.push_back(g.nbrs.size());
+    for (int c=1; c!=n; ++c) {
+      g.nbrs.push_back(0);
+      g.offsets.push_back(g.nbrs.size());
+    }
+    return g;
+  }
+};
+
+
+double totalVolume(const std::vector<double>& area, const std::vector<double>& depth)
+{
+  return std::inner_product(area.begin(), area.end(), depth.begin(), 0.);
+}
+
+
+TEST(FILL_AND_SPILL_CONSERVATION) {
+  int nx = 7, ny = 6;
+  auto g = TestGraph::Grid(nx, ny);
+  FillAndSpill fs(g.offsets, g.nbrs);
+  CHECK_EQUAL(nx*ny, fs.num_cells());
+
+  // a rough surface, with several pits, uneven areas, and uneven deposition
+  std::vector<double> base(nx*ny), area(nx*ny), volume(nx*ny), depth(nx*ny);
+  unsigned int seed = 12345;
+  auto rand = [&seed]() {
+    seed = 1103515245u * seed + 12345u;
+    return ((seed >> 8) & 0xffff) / 65536.;
+  };
+  for (int c=0; c!=nx*ny; ++c) {
+    base[c] = rand();
+    area[c] = 0.5 + rand();
+    volume[c] = 0.1 * rand();
+  }
+  double vol_in = std::accumulate(volume.begin(), volume.end(), 0.);
+
+  fs.Distribute(base.data(), area.data(), volume.data(), depth.data());
+  for (int c=0; c!=nx*ny; ++c) CHECK(depth[c] >= 0.);
+  CHECK_CLOSE(vol_in, totalVolume(area, depth), 1.e-12 * vol_in);
+
+  // and with enough volume to flood everything
+  for (auto& v : volume) v *= 100.;
+  vol_in = std::accumulate(volume.begin(), volume.end(), 0.);
+  fs.Distribute(base.data(), area.data(), volume.data(), depth.data());
+  CHECK_CLOSE(vol_in, totalVolume(area, depth), 1.e-12 * vol_in);
+  double level = base[0] + depth[0];
+  for (int c=0; c!=nx*ny; ++c) CHECK_CLOSE(level, base[c] + depth[c], 1.e-10);
+}
+
+
+TEST(FILL_AND_SPILL_SPILL_TO_LOWEST) {
+  // Three pits meet at a saddle (cell 0, at 2).  The pit at 1 receives twice
+  // its capacity, and the excess spills into the lowest pit, not the other.
+  auto g = TestGraph::Star(4);
+  FillAndSpill fs(g.offsets, g.nbrs);
+
+  std::vector<double> base = { 2., 1., 0.5, 0. };
+  std::vector<double> area(4, 1.);
+  std::vector<double> volume = { 0., 2., 0., 0. };
+  std::vector<double> depth(4);
+  fs.Distribute(base.data(), area.data(), volume.data(), depth.data());
+
+  CHECK_CLOSE(0., depth[0], 1.e-12);
+  CHECK_CLOSE(1., depth[1], 1.e-12);
+  CHECK_CLOSE(0., depth[2], 1.e-12);
+  CHECK_CLOSE(1., depth[3], 1.e-12);
+}
+
+
+TEST(FILL_AND_SPILL_SPILL_OVER_LOWEST_RIM) {
+  // A pit at 1 (cell 2) has rims at 2 (cell 1, toward a pit at 0) and at 3
+  // (cell 3, toward a pit at 0.5).  Volume beyond its capacity crosses the
+  // lower rim.
+  auto g = TestGraph::Line(5);
+  FillAndSpill fs(g.offsets, g.nbrs);
+
+  std::vector<double> base = { 0., 2., 1., 3., 0.5 };
+  std::vector<double> area(5, 1.);
+  std::vector<double> volume = { 0., 0., 2., 0., 0. };
+  std::vector<double> depth(5);
+  fs.Distribute(base.data(), area.data(), volume.data(), depth.data());
+
+  CHECK_CLOSE(1., depth[0], 1.e-12);
+  CHECK_CLOSE(0., depth[1], 1.e-12);
+  CHECK_CLOSE(1., depth[2], 1.e-12);
+  CHECK_CLOSE(0., depth[3], 1.e-12);
+  CHECK_CLOSE(0., depth[4], 1.e-12);
+}
+
+
+TEST(FILL_AND_SPILL_FILLED_DEPRESSION) {
+  // Volume overtopping the rim between two pits forms a single lake with a
+  // flat surface.
+  auto g = TestGraph::Line(5);
+  FillAndSpill fs(g.offsets, g.nbrs);
+
+  std::vector<double> base = { 0., 2., 1., 3., 0.5 };
+  std::vector<double> area = { 1., 2., 1., 1., 1. };
+  std::vector<double> volume = { 0., 0., 4., 0., 0. };
+  std::vector<double> depth(5);
+  fs.Distribute(base.data(), area.data(), volume.data(), depth.data());
+
+  // capacity below the rim at 2 is 3, and the last 1 spreads over all three
+  // cells (area 4) of the merged lake
+  double level = 2.25;
+  CHECK_CLOSE(level - base[0], depth[0], 1.e-12);
+  CHECK_CLOSE(level - base[1], depth[1], 1.e-12);
+  CHECK_CLOSE(level - base[2], depth[2], 1.e-12);
+  CHECK_CLOSE(0., depth[3], 1.e-12);
+  CHECK_CLOSE(0., depth[4], 1.e-12);
+
+  // The result is a steady state: redistributing the volume it holds gives
+  // the same depths.
+  std::vector<double> held(5), depth2(5);
+  for (int c=0; c!=5; ++c) held[c] = area[c] * depth[c];
+  fs.Distribute(base.data(), area.data(), held.data(), depth2.data());
+  for (int c=0; c!=5; ++c) CHECK_CLOSE(depth[c], depth2[c], 1.e-12);
+
+}
+
@@ -9,6 +9,7 @@ A DomainSet coupler, couples a bunch of domains of the same structure.
 
 ------------------------------------------------------------------------- */
 
+#include <limits>
 #include "DomainSetMPC.hh"
 
 namespace Amanzi {
@@ -27,21 +28,99 @@ DomainSetMPC::DomainSetMPC(Teuchos::ParameterList& pk_tree,
 
   KeyTriple triple;
   bool is_ds = Keys::splitDomainSet(dsname, triple);
+  if (is_ds && !S->HasDomainSet(std::get<0>(triple)) && S->HasMesh(std::get<0>(triple))) {
+    Errors::Message msg;
+    msg << "DomainSetMPC: domain set \"" << std::get<0>(triple) << "\" is batched (\"batch columns\")"
+        << " and has no per-column subdomains to advance; unset \"batch columns\" to use \""
+        << dsname << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
   if (!is_ds || !S->HasDomainSet(std::get<0>(triple))) {
     Errors::Message msg;
     msg << "DomainSetMPC: \"" << dsname << "\" should be a domain-set of the form DOMAIN_*-PK_NAME";
     Exceptions::amanzi_throw(msg);
   }
 
+  // the domain of each sub-PK, for subcycling, starting with any listed
+  // before the domain set
+  std::vector<std::string> domains;
+  for (const auto& subpk : subpks) {
+    std::string domain;
+    if (pks_list_->isSublist(subpk))
+      domain = pks_list_->sublist(subpk).template get<std::string>("domain name", "");
+    domains.push_back(domain);
+  }
+
   // add for the various sub-pks based on IDs
   auto ds = S->GetDomainSet(std::get<0>(triple));
   for (auto& subdomain : *ds) {
     subpks.push_back(Keys::getKey(subdomain, std::get<2>(triple)));
+    domains.push_back(subdomain);
   }
   this->plist_->template set("PKs order", subpks);
+  sub_pk_domains_ = SubPKDomains(domains,
+          [&S](const std::string& domain) { return S->HasMesh(domain); });
 
   // construct the sub-PKs on COMM_SELF
   MPC<PK>::init_(S, getCommSelf());
+
+  // optionally subcycle each sub-PK independently
+  subcycled_ = this->plist_->template get<bool>("subcycle subdomains", false);
+  subcycled_target_dt_ = this->plist_->template get<double>("subcycling target timestep [s]", 86400.);
+  subcycled_min_dt_ = this->plist_->template get<double>("minimum subcycled timestep [s]", 1.e-4);
+  if (subcycled_ && !this->global_list_->template get<bool>("support subcycling", false)) {
+    // without its own intermediate state, S_inter_ is the committed state,
+    // and committing inner steps into it would corrupt recovery from a
+    // failed coordinator step
+    Errors::Message msg;
+    msg << "DomainSetMPC \"" << name_ << "\": \"subcycle subdomains\" requires \"support subcycling\" to be true in the main list.";
+    Exceptions::amanzi_throw(msg);
+  }
+  if (subcycled_) {
+    for (int i=0; i!=sub_pks_.size(); ++i) {
+      if (sub_pk_domains_[i].empty()) {
+        Errors::Message msg;
+        msg << "DomainSetMPC \"" << name_ << "\": \"subcycle subdomains\" requires a \"domain name\" for sub-PK \""
+            << sub_pks_[i]->name() << "\", to restore it after a failed inner step.";
+        Exceptions::amanzi_throw(msg);
+      }
+    }
+  }
+
+  // optionally advance the sub-PKs concurrently
+  int nthreads = this->plist_->template get<int>("column advance threads", 1);
+  if (nthreads > 1) {
+    if (subcycled_) {
+      Errors::Message msg;
+      msg << "DomainSetMPC \"" << name_ << "\": \"column advance threads\" is not supported with \"subcycle subdomains\".";
+      Exceptions::amanzi_throw(msg);
+    } else if (ColumnThreadPool::IsSupported()) {
+      std::vector<std::string> task_pks;
+      for (const auto& pk : sub_pks_) task_pks.push_back(pk->name());
+      ColumnThreadPool::CheckTasks("DomainSetMPC \"" + name_ + "\"", *pks_list_, task_pks);
+      thread_pool_ = Teuchos::rcp(new ColumnThreadPool(nthreads));
+    } else {
+      Errors::Message msg;
+      msg << "DomainSetMPC \"" << name_ << "\": \"column advance threads\" requires Trilinos built with Teuchos_ENABLE_THREAD_SAFE and MPI providing MPI_THREAD_MULTIPLE.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+}
+
+
+std::vector<std::vector<std::string> >
+DomainSetMPC::SubPKDomains(const std::vector<std::string>& domains,
+                           const std::function<bool(const std::string&)>& has_mesh)
+{
+  std::vector<std::vector<std::string> > sub_pk_domains(domains.size());
+  for (int i=0; i!=domains.size(); ++i) {
+    if (domains[i].empty()) continue;
+    sub_pk_domains[i].push_back(domains[i]);
+    for (const auto& prefix : { "surface_", "snow_" }) {
+      if (has_mesh(prefix + domains[i])) sub_pk_domains[i].push_back(prefix + domains[i]);
+    }
+  }
+  return sub_pk_domains;
 }
 
 
@@ -52,6 +131,9 @@ double DomainSetMPC::get_dt() {
     dt = std::min<double>(dt,pk->get_dt());
   }
   
+  // when subcycling, sub-PKs smaller than the target take multiple steps
+  if (subcycled_) dt = std::max(dt, subcycled_target_dt_);
+
   double dt_local = dt;
   solution_->Comm()->MinAll(&dt_local, &dt, 1);
   
@@ -73,12 +155,60 @@ void DomainSetMPC::set_dt( double dt) {
 // Semi coupled thermal hydrology
 bool 
 DomainSetMPC::AdvanceStep(double t_old, double t_new, bool reinit) {
+  if (subcycled_) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    int nsteps_min(std::numeric_limits<int>::max()), nsteps_max(0), nsteps_total(0);
+    int nfails_total(0), nsubcycled(0), ncrashed(0);
+    for (int i=0; i!=sub_pks_.size(); ++i) {
+      int nsteps(0), nfails(0);
+      if (AdvanceSubcycled_(i, t_old, t_new, nsteps, nfails)) {
+        ncrashed++;
+        break;
+      }
+      nsteps_min = std::min(nsteps_min, nsteps);
+      nsteps_max = std::max(nsteps_max, nsteps);
+      nsteps_total += nsteps;
+      nfails_total += nfails;
+      if (nsteps > 1) nsubcycled++;
+    }
+    S_inter_->set_time(t_old);
+    S_next_->set_time(t_new);
+
+    // a crashed sub-PK fails the coordinator's step, on all ranks
+    int ncrashed_global(0);
+    solution_->Comm()->SumAll(&ncrashed, &ncrashed_global, 1);
+    if (ncrashed_global) return true;
+
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+      int local[3] = { nsteps_total, nfails_total, nsubcycled };
+      int global[3];
+      solution_->Comm()->SumAll(local, global, 3);
+      int nsteps_min_g, nsteps_max_g;
+      solution_->Comm()->MinAll(&nsteps_min, &nsteps_min_g, 1);
+      solution_->Comm()->MaxAll(&nsteps_max, &nsteps_max_g, 1);
+      int npks_l = sub_pks_.size();
+      int npks_g;
+      solution_->Comm()->SumAll(&npks_l, &npks_g, 1);
+
+      *vo_->os() << "Subcycled " << global[2] << " of " << npks_g << " subdomains: steps per subdomain"
+                 << " min/mean/max = " << nsteps_min_g << "/"
+                 << static_cast<double>(global[0]) / std::max(npks_g, 1) << "/" << nsteps_max_g
+                 << ", failed inner steps = " << global[1] << std::endl;
+    }
+    return false;
+  }
+
   int nfailed = 0;
-  for (const auto& pk : sub_pks_) {
-    bool fail = pk->AdvanceStep(t_old, t_new, reinit);
-    if (fail) {
-      nfailed++;
-      break;
+  if (thread_pool_ != Teuchos::null) {
+    nfailed = thread_pool_->Run(sub_pks_.size(),
+            [&](int i) { return sub_pks_[i]->AdvanceStep(t_old, t_new, reinit); });
+  } else {
+    for (const auto& pk : sub_pks_) {
+      bool fail = pk->AdvanceStep(t_old, t_new, reinit);
+      if (fail) {
+        nfailed++;
+        break;
+      }
     }
   }
 
@@ -87,6 +217,76 @@ DomainSetMPC::AdvanceStep(double t_old, double t_new, bool reinit) {
   if (nfailed_global) return true;
   return false;
 }
+
+
+// -----------------------------------------------------------------------------
+// Subcycle one sub-PK across the coordinator's step.  Failed inner steps
+// restore only that sub-PK's domains from S_inter_.  Returns true if the
+// sub-PK's timestep crashed.
+// -----------------------------------------------------------------------------
+bool
+DomainSetMPC::AdvanceSubcycled_(int i, double t_old, double t_new,
+        int& nsteps, int& nfails)
+{
+  const auto& pk = sub_pks_[i];
+  double t_inner = t_old;
+  bool done = false;
+
+  S_inter_->set_time(t_old);
+  while (!done) {
+    double dt_inner = std::min(pk->get_dt(), t_new - t_inner);
+    *S_next_->GetScalarData("dt", "coordinator") = dt_inner;
+    S_next_->set_time(t_inner + dt_inner);
+
+    bool fail_inner = pk->AdvanceStep(t_inner, t_inner + dt_inner, false);
+    fail_inner |= !pk->ValidStep();
+
+    if (fail_inner) {
+      nfails++;
+      for (const auto& domain : sub_pk_domains_[i]) S_next_->AssignDomain(*S_inter_, domain);
+      S_next_->set_time(S_inter_->time());
+      dt_inner = pk->get_dt();
+
+      if (vo_->os_OK(Teuchos::VERB_EXTREME))
+        *vo_->os() << "  " << pk->name() << " failed, new timestep is " << dt_inner << std::endl;
+
+    } else {
+      nsteps++;
+      pk->CommitStep(t_inner, t_inner + dt_inner, S_next_);
+      t_inner += dt_inner;
+      if (t_inner >= t_new - 1.e-10) done = true;
+
+      for (const auto& domain : sub_pk_domains_[i]) S_inter_->AssignDomain(*S_next_, domain);
+      S_inter_->set_time(S_next_->time());
+      dt_inner = pk->get_dt();
+    }
+
+    if (!done && dt_inner < subcycled_min_dt_) {
+      if (vo_->os_OK(Teuchos::VERB_LOW))
+        *vo_->os() << "  " << pk->name() << " crashing timestep in subcycling: dt = " << dt_inner << std::endl;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// -----------------------------------------------------------------------------
+// When subcycling, sub-PKs have validated and committed their own steps.
+// -----------------------------------------------------------------------------
+bool
+DomainSetMPC::ValidStep() {
+  if (subcycled_) return true;
+  return MPC<PK>::ValidStep();
+}
+
+
+void
+DomainSetMPC::CommitStep(double t_old, double t_new,
+                         const Teuchos::RCP<State>& S) {
+  if (subcycled_) return;
+  MPC<PK>::CommitStep(t_old, t_new, S);
+}
   
 
 } // namespace Amanzi
@@ -9,14 +9,53 @@
 */
 
 /*!
-  
+
+Weakly couples a collection of identical PKs, one on each subdomain of a
+domain set, advancing each in turn over the same timestep.  Sub-PKs are
+constructed on COMM_SELF.
+
+.. _domain-set-mpc-spec:
+.. admonition:: domain-set-mpc-spec
+
+    * `"PKs order`" ``[Array(string)]`` Any number of PKs, the last of which
+      is a domain-set PK name of the form `"DOMAIN_*-PK_NAME`".
+    * `"column advance threads`" ``[int]`` **1** If greater than 1, the
+      sub-PKs are advanced concurrently on this many threads.  Sub-PKs must
+      then run with `"verbosity level`" `"none`", which is checked at
+      construction.  See ColumnThreadPool for the requirements this places on
+      sub-PKs.
+    * `"subcycle subdomains`" ``[bool]`` **false** If true, each sub-PK
+      subcycles independently on its own timestep size within the
+      coordinator's step.  A failed inner step is repeated only by the
+      sub-PK that failed, with its own reduced timestep, rather than forcing
+      every subdomain on every rank to repeat the step.  Subcycle counts are
+      summarized at high verbosity.
+    * `"subcycling target timestep [s]`" ``[double]`` **86400** When
+      subcycling, the coordinator's timestep is the larger of this and the
+      smallest sub-PK timestep.
+    * `"minimum subcycled timestep [s]`" ``[double]`` **1.e-4** When
+      subcycling, the coordinator's step fails if any sub-PK's timestep
+      falls below this.
+
+    Subcycling commits inner steps into the intermediate State, so it
+    requires `"support subcycling`" to be true in the main list.  A failed
+    inner step restores the domains of its sub-PK, which for PKs listed
+    before the domain set are taken from their `"domain name`".
+
+    INCLUDES:
+
+    - ``[mpc-spec]`` *Is a* MPC_.
+
  */
 
 #pragma once
 
+#include <functional>
+
 #include "Key.hh"
 #include "PK.hh"
 #include "mpc.hh"
+#include "column_thread_pool.hh"
 
 namespace Amanzi {
 
@@ -33,9 +72,32 @@ class DomainSetMPC : public MPC<PK> {
   virtual double get_dt();
   virtual void set_dt(double dt);
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit);
+  virtual bool ValidStep();
+  virtual void CommitStep(double t_old, double t_new,
+                          const Teuchos::RCP<State>& S);
+
+  // Domains written by each sub-PK, in "PKs order", given the domain of each
+  // (empty if unknown): that domain and, where has_mesh, its surface_ and
+  // snow_ domains.
+  static std::vector<std::vector<std::string> >
+  SubPKDomains(const std::vector<std::string>& domains,
+               const std::function<bool(const std::string&)>& has_mesh);
 
  protected:
+  // Advance sub-PK i from t_old to t_new on its own timestep, returning the
+  // number of inner steps taken and failed.  Returns true if the sub-PK's
+  // timestep fell below the minimum.
+  bool AdvanceSubcycled_(int i, double t_old, double t_new,
+                         int& nsteps, int& nfails);
+
   std::string pks_set_;
+  Teuchos::RCP<ColumnThreadPool> thread_pool_;
+
+  // subcycling control
+  bool subcycled_;
+  double subcycled_target_dt_;
+  double subcycled_min_dt_;
+  std::vector<std::vector<std::string> > sub_pk_domains_; // indexed as sub_pks_
 
  private:
   // factory registration
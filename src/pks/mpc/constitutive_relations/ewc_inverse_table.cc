@@ -0,0 +1,312 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+EWCInverseTable is a precomputed inverse of an EWCModel, (energy, water
+content) -> (temperature, pressure), for one set of cell parameters.
+
+------------------------------------------------------------------------- */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "Teuchos_Array.hpp"
+#include "errors.hh"
+
+#include "ewc_inverse_table.hh"
+
+namespace Amanzi {
+
+namespace {
+
+std::vector<double> readRange(Teuchos::ParameterList& plist, const std::string& name,
+        double lower, double upper) {
+  std::vector<double> range(2);
+  range[0] = lower;
+  range[1] = upper;
+  if (plist.isParameter(name)) {
+    range = plist.get<Teuchos::Array<double> >(name).toVector();
+    if (range.size() != 2 || range[0] >= range[1]) {
+      Errors::Message msg;
+      msg << "EWCInverseTable: \"" << name << "\" must be an increasing pair of values.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+  return range;
+}
+
+// Table parameters, in the order read, which identify a table along with the
+// model.
+std::vector<double> readTableParameters(Teuchos::ParameterList& plist) {
+  std::vector<double> T_range = readRange(plist, "temperature range [K]", 253.15, 283.15);
+  std::vector<double> p_range = readRange(plist, "pressure range [Pa]", -1.e5, 3.e5);
+  return std::vector<double>{ T_range[0], T_range[1], p_range[0], p_range[1],
+        plist.get<double>("temperature tolerance [K]", 0.01),
+        plist.get<double>("pressure tolerance [Pa]", 100.),
+        static_cast<double>(plist.get<int>("base resolution", 16)),
+        static_cast<double>(plist.get<int>("maximum refinement level", 6)) };
+}
+
+} // namespace
+
+
+Teuchos::RCP<const EWCInverseTable>
+EWCInverseTable::Get(const std::string& scope, EWCModel& model,
+                     const Teuchos::Ptr<State>& S, int c,
+                     const std::vector<double>& params, Teuchos::ParameterList& plist,
+                     bool& built)
+{
+  typedef std::tuple<std::string, std::string, std::vector<double>, std::vector<double> > Key;
+  static std::map<Key, Teuchos::RCP<const EWCInverseTable> > registry;
+
+  Key key(scope, typeid(model).name(), params, readTableParameters(plist));
+  auto& table = registry[key];
+  built = table == Teuchos::null;
+  if (built) table = Teuchos::rcp(new EWCInverseTable(model, S, c, plist));
+  return table;
+}
+
+
+EWCInverseTable::EWCInverseTable(EWCModel& model, const Teuchos::Ptr<State>& S, int c,
+        Teuchos::ParameterList& plist) :
+    e_min_(0.), e_max_(0.),
+    wc_min_(0.), wc_max_(0.),
+    ntrusted_(0),
+    ninversions_(0)
+{
+  std::vector<double> table_params = readTableParameters(plist);
+  std::vector<double> T_range = { table_params[0], table_params[1] };
+  std::vector<double> p_range = { table_params[2], table_params[3] };
+  double tol_T = table_params[4];
+  double tol_p = table_params[5];
+  n0_ = static_cast<int>(table_params[6]);
+  int max_level = static_cast<int>(table_params[7]);
+
+  // Sample the forward map over the (T,p) box, giving the extent of the table
+  // and initial guesses for inverting where there is nothing to interpolate.
+  int nsamples = 33;
+  std::vector<double> sample_e, sample_wc, sample_T, sample_p;
+  e_min_ = wc_min_ = std::numeric_limits<double>::max();
+  e_max_ = wc_max_ = -std::numeric_limits<double>::max();
+  for (int j=0; j!=nsamples; ++j) {
+    for (int i=0; i!=nsamples; ++i) {
+      double T = T_range[0] + (T_range[1] - T_range[0]) * i / (nsamples-1);
+      double p = p_range[0] + (p_range[1] - p_range[0]) * j / (nsamples-1);
+      double e, wc;
+      if (model.Evaluate(T, p, e, wc)) continue;
+      sample_e.push_back(e);
+      sample_wc.push_back(wc);
+      sample_T.push_back(T);
+      sample_p.push_back(p);
+      e_min_ = std::min(e_min_, e);
+      e_max_ = std::max(e_max_, e);
+      wc_min_ = std::min(wc_min_, wc);
+      wc_max_ = std::max(wc_max_, wc);
+    }
+  }
+  if (sample_e.empty() || e_max_ <= e_min_ || wc_max_ <= wc_min_) {
+    // nothing to tabulate, all lookups fail
+    e_min_ = e_max_ = wc_min_ = wc_max_ = 0.;
+    return;
+  }
+
+  // Inverses are stored at nodes of the finest grid, which includes the test
+  // points of cells at the maximum level.
+  long N = static_cast<long>(n0_) << (max_level + 1);
+  auto node_e = [=](long I) { return e_min_ + (e_max_ - e_min_) * I / N; };
+  auto node_wc = [=](long J) { return wc_min_ + (wc_max_ - wc_min_) * J / N; };
+
+  std::unordered_map<long, int> node_index;
+  std::vector<double> node_T, node_p;
+  std::vector<bool> node_valid;
+
+  // nodes to be inverted, with their initial guesses
+  std::vector<long> pending;
+  std::vector<double> pending_e, pending_wc, pending_T, pending_p;
+
+  auto seed = [&](double e, double wc, double& T, double& p) {
+    double dist_min = std::numeric_limits<double>::max();
+    for (int k=0; k!=(int) sample_e.size(); ++k) {
+      double de = (sample_e[k] - e) / (e_max_ - e_min_);
+      double dwc = (sample_wc[k] - wc) / (wc_max_ - wc_min_);
+      double dist = de*de + dwc*dwc;
+      if (dist < dist_min) {
+        dist_min = dist;
+        T = sample_T[k];
+        p = sample_p[k];
+      }
+    }
+  };
+
+  // Requests the inverse at node (I,J), with an initial guess if given.
+  auto request = [&](long I, long J, const double* guess_T, const double* guess_p) {
+    long key = I * (N+1) + J;
+    if (node_index.count(key)) return;
+    node_index[key] = -1;
+    double e = node_e(I);
+    double wc = node_wc(J);
+    double T, p;
+    if (guess_T) {
+      T = *guess_T;
+      p = *guess_p;
+    } else {
+      seed(e, wc, T, p);
+    }
+    pending.push_back(key);
+    pending_e.push_back(e);
+    pending_wc.push_back(wc);
+    pending_T.push_back(T);
+    pending_p.push_back(p);
+  };
+
+  // Inverts all requested nodes at once.
+  auto invert = [&]() {
+    int n = pending.size();
+    if (n == 0) return;
+    std::vector<int> cells(n, c);
+    std::vector<int> ierr(n), iters(n);
+    model.InverseEvaluateBatch(S, cells, pending_e.data(), pending_wc.data(),
+                               pending_T.data(), pending_p.data(), ierr.data(), iters.data());
+    for (int k=0; k!=n; ++k) {
+      node_index[pending[k]] = node_T.size();
+      node_T.push_back(pending_T[k]);
+      node_p.push_back(pending_p[k]);
+      node_valid.push_back(ierr[k] == 0);
+    }
+    ninversions_ += n;
+    pending.clear();
+    pending_e.clear();
+    pending_wc.clear();
+    pending_T.clear();
+    pending_p.clear();
+  };
+
+  auto node = [&](long I, long J) { return node_index.at(I * (N+1) + J); };
+
+  // corners and test points of a cell, in units of half its width
+  const int corners[4][2] = { {0,0}, {2,0}, {0,2}, {2,2} };
+  const int tests[5][2] = { {1,1}, {1,0}, {0,1}, {2,1}, {1,2} };
+
+  std::vector<int> level_cells;
+  for (int j=0; j!=n0_; ++j) {
+    for (int i=0; i!=n0_; ++i) {
+      level_cells.push_back(cells_.size());
+      cells_.push_back(Cell_{0, i, j, -1, false, {0.,0.,0.,0.}, {0.,0.,0.,0.}});
+    }
+  }
+
+  for (int level=0; !level_cells.empty(); ++level) {
+    long half = N / (static_cast<long>(n0_) << level) / 2;
+
+    // The corners of refined cells were test points of their parents.
+    if (level == 0) {
+      for (int k : level_cells) {
+        for (const auto& corner : corners) {
+          request((cells_[k].i*2 + corner[0]) * half, (cells_[k].j*2 + corner[1]) * half,
+                  nullptr, nullptr);
+        }
+      }
+      invert();
+    }
+
+    std::vector<char> corners_valid(level_cells.size());
+    for (int n=0; n!=(int) level_cells.size(); ++n) {
+      Cell_& cell = cells_[level_cells[n]];
+      bool valid = true;
+      for (int m=0; m!=4; ++m) {
+        int nd = node((cell.i*2 + corners[m][0]) * half, (cell.j*2 + corners[m][1]) * half);
+        cell.T[m] = node_T[nd];
+        cell.p[m] = node_p[nd];
+        valid &= node_valid[nd];
+      }
+      corners_valid[n] = valid;
+
+      // test points, which are guessed from the interpolant when possible
+      if (valid || level < max_level) {
+        for (const auto& test : tests) {
+          double T = Interpolate_(cell.T, 0.5*test[0], 0.5*test[1]);
+          double p = Interpolate_(cell.p, 0.5*test[0], 0.5*test[1]);
+          request((cell.i*2 + test[0]) * half, (cell.j*2 + test[1]) * half,
+                  valid ? &T : nullptr, valid ? &p : nullptr);
+        }
+      }
+    }
+    invert();
+
+    std::vector<int> next_cells;
+    for (int n=0; n!=(int) level_cells.size(); ++n) {
+      int k = level_cells[n];
+      const Cell_& cell = cells_[k];
+      bool trusted = corners_valid[n];
+      bool any_valid = false;  // refine only where the inverse exists somewhere
+      for (int m=0; m!=4; ++m) {
+        any_valid |= node_valid[node((cell.i*2 + corners[m][0]) * half,
+                                     (cell.j*2 + corners[m][1]) * half)];
+      }
+      if (corners_valid[n] || level < max_level) {
+        for (int m=0; m!=5; ++m) {
+          int nd = node((cell.i*2 + tests[m][0]) * half, (cell.j*2 + tests[m][1]) * half);
+          any_valid |= node_valid[nd];
+          trusted = trusted && node_valid[nd]
+              && std::abs(Interpolate_(cell.T, 0.5*tests[m][0], 0.5*tests[m][1]) - node_T[nd]) <= tol_T
+              && std::abs(Interpolate_(cell.p, 0.5*tests[m][0], 0.5*tests[m][1]) - node_p[nd]) <= tol_p;
+        }
+      }
+
+      if (trusted) {
+        cells_[k].trusted = true;
+        ntrusted_++;
+      } else if (level < max_level && any_valid) {
+        int first = cells_.size();
+        cells_[k].children = first;
+        int i = cells_[k].i, j = cells_[k].j;
+        for (int cj=0; cj!=2; ++cj) {
+          for (int ci=0; ci!=2; ++ci) {
+            next_cells.push_back(cells_.size());
+            cells_.push_back(Cell_{level+1, 2*i+ci, 2*j+cj, -1, false,
+                                   {0.,0.,0.,0.}, {0.,0.,0.,0.}});
+          }
+        }
+      }
+    }
+    level_cells.swap(next_cells);
+  }
+}
+
+
+bool EWCInverseTable::Lookup(double energy, double wc, double& T, double& p) const {
+  if (e_max_ <= e_min_) return false;
+
+  double x = (energy - e_min_) / (e_max_ - e_min_) * n0_;
+  double y = (wc - wc_min_) / (wc_max_ - wc_min_) * n0_;
+  if (!(x >= 0. && x <= n0_ && y >= 0. && y <= n0_)) return false;
+
+  int i = std::min(static_cast<int>(x), n0_-1);
+  int j = std::min(static_cast<int>(y), n0_-1);
+  int k = j*n0_ + i;
+  x -= i;
+  y -= j;
+  while (cells_[k].children >= 0) {
+    int ci = x < 0.5 ? 0 : 1;
+    int cj = y < 0.5 ? 0 : 1;
+    x = 2*x - ci;
+    y = 2*y - cj;
+    k = cells_[k].children + ci + 2*cj;
+  }
+
+  const Cell_& cell = cells_[k];
+  if (!cell.trusted) return false;
+  T = Interpolate_(cell.T, x, y);
+  p = Interpolate_(cell.p, x, y);
+  return true;
+}
+
+} // namespace
@@ -0,0 +1,110 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+EWCInverseTable is a precomputed inverse of an EWCModel, (energy, water
+content) -> (temperature, pressure), for one set of cell parameters.
+
+The inverse is tabulated on a quadtree over the box in (energy, water content)
+space spanned by the forward map of a (T,p) box.  Starting from a uniform grid,
+each cell computes the Newton inverse at its corners and at its center and
+edge midpoints.  A cell whose bilinear interpolant of the corners matches the
+inverse at those test points within tolerance is trusted; otherwise it is
+refined, up to a maximum level, after which it is left untrusted.  Test points
+of a cell are the corners of its children, so refining reuses every inverse.
+Cells touching unreachable (energy, water content), where the inverse fails,
+are never trusted.
+
+Cell parameters identify the relations of a cell only among domains built
+from the same model specs, e.g. they hold WRM and porosity region indices.
+Tables are therefore shared through Get() only within a scope, such as a
+domain set, whose domains share those specs, by models of the same type,
+cell parameters and table list.  In this way the columns of a domain set
+build each table once.
+
+Lookups outside of the trusted cells return false, and the caller should fall
+back to Newton.  This includes saturated, compressible states, where pressure
+is poorly determined by water content and the table would need to be very fine.
+The default tolerances are meant for predictors and preconditioners, which
+only need to be close.
+
+.. _ewc-inverse-table-spec:
+.. admonition:: ewc-inverse-table-spec
+
+    * `"temperature range [K]`" ``[Array(double)]`` **{253.15, 283.15}**
+    * `"pressure range [Pa]`" ``[Array(double)]`` **{-100000, 300000}**
+    * `"temperature tolerance [K]`" ``[double]`` **0.01** Maximum error of
+      the interpolated temperature at test points of a trusted cell.
+    * `"pressure tolerance [Pa]`" ``[double]`` **100** Maximum error of the
+      interpolated pressure at test points of a trusted cell.
+    * `"base resolution`" ``[int]`` **16** Number of cells in each direction
+      of the unrefined table.
+    * `"maximum refinement level`" ``[int]`` **6**
+
+------------------------------------------------------------------------- */
+
+#ifndef AMANZI_EWC_INVERSE_TABLE_HH_
+#define AMANZI_EWC_INVERSE_TABLE_HH_
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "ewc_model.hh"
+
+namespace Amanzi {
+
+class EWCInverseTable {
+ public:
+  // Builds the table for model, as updated to cell c.
+  EWCInverseTable(EWCModel& model, const Teuchos::Ptr<State>& S, int c,
+                  Teuchos::ParameterList& plist);
+
+  // Returns the table shared within scope by models of this type with cell
+  // parameters params, building it from model, as updated to cell c, if it
+  // does not yet exist.  scope must name a set of domains whose models are
+  // built from the same specs.  built is set to whether it was built.  Not
+  // thread safe, tables are built during initialization.
+  static Teuchos::RCP<const EWCInverseTable>
+  Get(const std::string& scope, EWCModel& model, const Teuchos::Ptr<State>& S,
+      int c, const std::vector<double>& params, Teuchos::ParameterList& plist,
+      bool& built);
+
+  // Interpolates T,p at an intensive energy and water content.  Returns false,
+  // leaving T and p unchanged, outside of the trusted cells.
+  bool Lookup(double energy, double wc, double& T, double& p) const;
+
+  int num_cells() const { return cells_.size(); }
+  int num_trusted_cells() const { return ntrusted_; }
+  int num_inversions() const { return ninversions_; }
+
+ private:
+  struct Cell_ {
+    int level;
+    int i, j;           // position among the cells of its level
+    int children;       // index of the first of four children, -1 for a leaf
+    bool trusted;
+    double T[4], p[4];  // corner values, ordered (0,0), (1,0), (0,1), (1,1)
+  };
+
+  static double Interpolate_(const double (&v)[4], double x, double y) {
+    return (1.-x)*(1.-y)*v[0] + x*(1.-y)*v[1] + (1.-x)*y*v[2] + x*y*v[3];
+  }
+
+ private:
+  double e_min_, e_max_;
+  double wc_min_, wc_max_;
+  int n0_;
+  std::vector<Cell_> cells_;  // the first n0_*n0_ are the roots, by row
+  int ntrusted_;
+  int ninversions_;
+};
+
+} // namespace
+
+#endif
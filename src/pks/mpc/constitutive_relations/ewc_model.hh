@@ -30,10 +30,33 @@ class EWCModel {
   virtual void InitializeModel(const Teuchos::Ptr<State>& S, Teuchos::ParameterList& plist) = 0;
   virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c) = 0;
 
+  // Parameters of the cell set by the last UpdateModel().  Cells with equal
+  // parameters share the same constitutive relations, and so may share
+  // precomputed inverses.  Empty if the model does not say.
+  virtual std::vector<double> CellParameters() { return std::vector<double>(); }
+
   virtual int Evaluate(double T, double p, double& energy, double& wc) = 0;
   virtual int InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose=false) = 0;
   virtual int InverseEvaluateEnergy(double energy, double p, double& T) = 0;
 
+  // Inverse evaluates a batch of cells, each with its own energy and water
+  // content, updating the model to each cell as needed.  T and p are the
+  // initial guesses on input.  ierr and iters are the error code (as in
+  // InverseEvaluate) and number of Newton iterations of each cell, where
+  // iters is -1 if not counted.  Returns the number of failed cells.
+  virtual int InverseEvaluateBatch(const Teuchos::Ptr<State>& S,
+          const std::vector<int>& cells, const double* energy, const double* wc,
+          double* T, double* p, int* ierr, int* iters) {
+    int nfailed = 0;
+    for (int i=0; i!=(int) cells.size(); ++i) {
+      UpdateModel(S, cells[i]);
+      ierr[i] = InverseEvaluate(energy[i], wc[i], T[i], p[i]);
+      iters[i] = -1;
+      if (ierr[i]) nfailed++;
+    }
+    return nfailed;
+  }
+
   virtual int EvaluateSaturations(double T, double p, double& s_gas, double& s_liq, double& s_ice) = 0;
 };
 
@@ -41,10 +41,50 @@ Error codes:
       because the cell is saturated or becomes saturated and below
       freezing.
   2 = Iteration did not converge in max_steps (hard-coded to be 100 for
-      now).
+      now), or backtracking did not reduce the residual in max_damping
+      (60) halvings.
 ---------------------------------------------------------------------- */
 int EWCModelBase::InverseEvaluate(double energy, double wc,
         double& T, double& p, bool verbose) {
+  int iters = 0;
+  return InverseEvaluate_(energy, wc, T, p, iters, &std::cout, verbose);
+}
+
+
+/* ----------------------------------------------------------------------
+Solves for temperature and pressure on a batch of cells.
+
+The model is updated to each cell once, and that cell's iteration is then
+run to completion, so the cost of UpdateModel() is paid once per cell rather
+than once per evaluation.
+
+Error codes are those of InverseEvaluate().  On failure, T and p of that
+cell are left at the initial guess.
+---------------------------------------------------------------------- */
+int EWCModelBase::InverseEvaluateBatch(const Teuchos::Ptr<State>& S,
+        const std::vector<int>& cells, const double* energy, const double* wc,
+        double* T, double* p, int* ierr, int* iters) {
+  int nfailed = 0;
+  for (int i=0; i!=(int) cells.size(); ++i) {
+    UpdateModel(S, cells[i]);
+    iters[i] = 0;
+    ierr[i] = InverseEvaluate_(energy[i], wc[i], T[i], p[i], iters[i], nullptr, false);
+    if (ierr[i]) nfailed++;
+  }
+  return nfailed;
+}
+
+
+/* ----------------------------------------------------------------------
+Newton iteration, with capped corrections and bounded backtracking, shared by
+InverseEvaluate() and InverseEvaluateBatch().
+
+T and p are only updated on success.  iters is the number of Newton steps
+taken.  Errors, and if verbose each iterate, are written to os if it is not
+null.
+---------------------------------------------------------------------- */
+int EWCModelBase::InverseEvaluate_(double energy, double wc,
+        double& T, double& p, int& iters, std::ostream* os, bool verbose) {
 
   // -- scaling for the norms
   double wc_scale = 1.;
@@ -52,21 +92,24 @@ int EWCModelBase::InverseEvaluate(double energy, double wc,
   double T_corr_cap = 2.;
   double p_corr_cap = 200000.;
   double tol = 1.e-6;
-  double max_steps = 100;
-  double stepnum = 0;
+  int max_steps = 100;
+  int max_damping = 60;
+  iters = 0;
+
+  verbose &= os != nullptr;
 
   // get the initial residual
   AmanziGeometry::Point res(2);
   WhetStone::Tensor jac(2,2);
   int ierr = EvaluateEnergyAndWaterContentAndJacobian_(T,p,res,jac);
   if (ierr) {
-    std::cout << "Error in evaluation: " << ierr << std::endl;
+    if (os) *os << "Error in evaluation: " << ierr << std::endl;
     return ierr + 10;
   }
 
   if (verbose) {
-    std::cout << "Inverse Evaluating, e=" << energy << ", wc=" << wc << std::endl;
-    std::cout << "   guess T,p (res) = " << T << ", " << p << " (" << res[0] << ", " << res[1] << ")" << std::endl;
+    *os << "Inverse Evaluating, e=" << energy << ", wc=" << wc << std::endl;
+    *os << "   guess T,p (res) = " << T << ", " << p << " (" << res[0] << ", " << res[1] << ")" << std::endl;
   }
 
   AmanziGeometry::Point f(2);
@@ -93,11 +136,13 @@ int EWCModelBase::InverseEvaluate(double energy, double wc,
     AmanziGeometry::Point correction;
 
     if (std::abs(detJ) < 1.e-20) {
-      std::cout << " Zero determinant of Jacobian:" << std::endl;
-      std::cout << "   [" << jac(0,0) << "," << jac(0,1) << "]" << std::endl;
-      std::cout << "   [" << jac(1,0) << "," << jac(1,1) << "]" << std::endl;
-      std::cout << "  at T,p = " << x_tmp[0] << ", " << x_tmp[1] << std::endl;
-      std::cout << "  with res(e,wc) = " << res[0] << ", " << res[1] << std::endl;
+      if (os) {
+        *os << " Zero determinant of Jacobian:" << std::endl;
+        *os << "   [" << jac(0,0) << "," << jac(0,1) << "]" << std::endl;
+        *os << "   [" << jac(1,0) << "," << jac(1,1) << "]" << std::endl;
+        *os << "  at T,p = " << x_tmp[0] << ", " << x_tmp[1] << std::endl;
+        *os << "  with res(e,wc) = " << res[0] << ", " << res[1] << std::endl;
+      }
       return 1;
     }
 
@@ -120,7 +165,7 @@ int EWCModelBase::InverseEvaluate(double energy, double wc,
     x_tmp = x - correction;
     ierr = EvaluateEnergyAndWaterContentAndJacobian_(x_tmp[0],x_tmp[1],res,jac);
     if (ierr) {
-      std::cout << "Error in evaluation: " << ierr << std::endl;
+      if (os) *os << "Error in evaluation: " << ierr << std::endl;
       return ierr + 10;
     }
     res = res - f;
@@ -130,24 +175,29 @@ int EWCModelBase::InverseEvaluate(double energy, double wc,
     double norm_new = AmanziGeometry::norm(scaled_res);
 
     if (verbose) {
-      std::cout << "  Iter: " << stepnum;
-      std::cout << " corrected T,p (res) [norm] = " << x_tmp[0] << ", " << x_tmp[1] << " (" << res[0] << ", " << res[1] << ") ["
-                << norm_new << "]" << std::endl;
+      *os << "  Iter: " << iters;
+      *os << " corrected T,p (res) [norm] = " << x_tmp[0] << ", " << x_tmp[1] << " (" << res[0] << ", " << res[1] << ") ["
+          << norm_new << "]" << std::endl;
     }
 
     double damp = 1.;
-    bool backtracking_required = false;
+    int ndamp = 0;
     while (norm_new > norm) {
-      backtracking_required = true;
+      if (ndamp == max_damping) {
+        if (os) *os << " Backtracking failed to reduce the residual after " << max_damping
+                    << " halvings at T,p = " << x[0] << ", " << x[1] << std::endl;
+        return 2;
+      }
 
       // backtrack
       damp *= 0.5;
+      ndamp++;
       x_tmp = x - (damp * correction);
 
       // evaluate the damped value
       ierr = EvaluateEnergyAndWaterContent_(x_tmp[0],x_tmp[1],res);
       if (ierr) {
-        std::cout << "Error in evaluation: " << ierr << std::endl;
+        if (os) *os << "Error in evaluation: " << ierr << std::endl;
         return ierr + 10;
       }
       res = res - f;
@@ -157,18 +207,17 @@ int EWCModelBase::InverseEvaluate(double energy, double wc,
       norm_new = AmanziGeometry::norm(scaled_res);
 
       if (verbose) {
-        std::cout << "    Damping: " << stepnum;
-        std::cout << " corrected T,p (res) [norm] = " << x_tmp[0] << ", " << x_tmp[1] << " (" << res[0] << ", " << res[1] << ") ["
-                  << norm_new << "]" << std::endl;
+        *os << "    Damping: " << iters;
+        *os << " corrected T,p (res) [norm] = " << x_tmp[0] << ", " << x_tmp[1] << " (" << res[0] << ", " << res[1] << ") ["
+            << norm_new << "]" << std::endl;
       }
-
     }
 
-    if (backtracking_required) {
+    if (ndamp > 0) {
       // must recalculate the Jacobian at the new value
       ierr = EvaluateEnergyAndWaterContentAndJacobian_(x_tmp[0],x_tmp[1],res,jac);
       if (ierr) {
-        std::cout << "Error in evaluation: " << ierr << std::endl;
+        if (os) *os << "Error in evaluation: " << ierr << std::endl;
         return ierr + 10;
       }
       res = res - f;
@@ -182,10 +231,10 @@ int EWCModelBase::InverseEvaluate(double energy, double wc,
     scaled_correction[1] = scaled_correction[1] / 100000.;
     converged = norm < tol || AmanziGeometry::norm(scaled_correction) < 1.e-10;
 
-    stepnum++;
-    if (stepnum > max_steps && !converged) {
-      std::cout << " Nonconverged after " << max_steps << " steps with norm (tol) "
-                << norm << " (" << tol << ")" << std::endl;
+    iters++;
+    if (iters > max_steps && !converged) {
+      if (os) *os << " Nonconverged after " << max_steps << " steps with norm (tol) "
+                  << norm << " (" << tol << ")" << std::endl;
       return 2;
     }
   }
@@ -13,6 +13,8 @@ evaluating.
 #ifndef AMANZI_EWC_MODEL_BASE_HH_
 #define AMANZI_EWC_MODEL_BASE_HH_
 
+#include <ostream>
+
 #include "Tensor.hh"
 #include "Point.hh"
 
@@ -28,6 +30,9 @@ class EWCModelBase : public EWCModel {
   virtual int Evaluate(double T, double p, double& energy, double& wc);
   virtual int InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose=false);
   virtual int InverseEvaluateEnergy(double energy, double p, double& T);
+  virtual int InverseEvaluateBatch(const Teuchos::Ptr<State>& S,
+          const std::vector<int>& cells, const double* energy, const double* wc,
+          double* T, double* p, int* ierr, int* iters);
 
  protected:
 
@@ -39,6 +44,11 @@ class EWCModelBase : public EWCModel {
 
   int EvaluateEnergyAndWaterContentAndJacobian_FD_(double T, double p,
           AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
+ private:
+  // Newton iteration of InverseEvaluate(), returning its error code
+  int InverseEvaluate_(double energy, double wc, double& T, double& p,
+                       int& iters, std::ostream* os, bool verbose);
 };
 
 } // namespace
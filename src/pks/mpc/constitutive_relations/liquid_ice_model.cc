@@ -123,8 +123,12 @@ void LiquidIceModel::InitializeModel(const Teuchos::Ptr<State>& S,
     AMANZI_ASSERT(poro_me != Teuchos::null);
     poro_leij_models_ = poro_me->get_Models();
   }
-  
 
+  // cell parameters are read at initialization, e.g. to tabulate inverses
+  for (const auto& name : { "density_rock", "base_porosity" }) {
+    Key key = Keys::getKey(domain, name);
+    if (S->HasFieldEvaluator(key)) S->GetFieldEvaluator(key)->HasFieldChanged(S, "ewc");
+  }
 }
 
 
@@ -133,15 +137,29 @@ void LiquidIceModel::UpdateModel(const Teuchos::Ptr<State>& S, int c) {
   p_atm_ = *S->GetScalarData("atmospheric_pressure");
   rho_rock_ = (*S->GetFieldData(Keys::getKey(domain,"density_rock"))->ViewComponent("cell"))[0][c];
   poro_ = (*S->GetFieldData(Keys::getKey(domain,"base_porosity"))->ViewComponent("cell"))[0][c];
-  wrm_ = wrms_->second[(*wrms_->first)[c]];
-  if(!poro_leij_)
-    poro_model_ = poro_models_->second[(*poro_models_->first)[c]];
-  else
-    poro_leij_model_ = poro_leij_models_->second[(*poro_leij_models_->first)[c]];
+  wrm_index_ = (*wrms_->first)[c];
+  wrm_ = wrms_->second[wrm_index_];
+  if(!poro_leij_) {
+    poro_index_ = (*poro_models_->first)[c];
+    poro_model_ = poro_models_->second[poro_index_];
+  } else {
+    poro_index_ = (*poro_leij_models_->first)[c];
+    poro_leij_model_ = poro_leij_models_->second[poro_index_];
+  }
     
   AMANZI_ASSERT(IsSetUp_());
 }
 
+std::vector<double> LiquidIceModel::CellParameters() {
+  std::vector<double> params(5);
+  params[0] = wrm_index_;
+  params[1] = poro_index_;
+  params[2] = poro_;
+  params[3] = rho_rock_;
+  params[4] = p_atm_;
+  return params;
+}
+
 bool LiquidIceModel::IsSetUp_() {
   if (wrm_ == Teuchos::null) return false;
   if (!poro_leij_) {
@@ -275,4 +293,106 @@ int LiquidIceModel::EvaluateEnergyAndWaterContent_(double T, double p, AmanziGeo
   return ierr;
 }
 
+
+int LiquidIceModel::EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+        AmanziGeometry::Point& result, WhetStone::Tensor& jac) {
+  if (T < 100.0 || T > 373.0) {
+    return 1; // invalid temperature
+  }
+  int ierr = 0;
+  std::vector<double> eos_param(2);
+
+  try {
+    double poro, dporo_dp;
+    if (!poro_leij_) {
+      poro = poro_model_->Porosity(poro_, p, p_atm_);
+      dporo_dp = poro_model_->DPorosityDPressure(poro_, p, p_atm_);
+    } else {
+      poro = poro_leij_model_->Porosity(poro_, p, p_atm_);
+      dporo_dp = poro_leij_model_->DPorosityDPressure(poro_, p, p_atm_);
+    }
+
+    double eff_p = std::max(p_atm_, p);
+    double deff_p_dp = p > p_atm_ ? 1. : 0.;
+
+    eos_param[0] = T;
+    eos_param[1] = eff_p;
+
+    double rho_l = liquid_eos_->MolarDensity(eos_param);
+    double drho_l_dT = liquid_eos_->DMolarDensityDT(eos_param);
+    double drho_l_dp = liquid_eos_->DMolarDensityDp(eos_param) * deff_p_dp;
+    double rho_i = ice_eos_->MolarDensity(eos_param);
+    double drho_i_dT = ice_eos_->DMolarDensityDT(eos_param);
+    double drho_i_dp = ice_eos_->DMolarDensityDp(eos_param) * deff_p_dp;
+
+    // pc_ice depends upon p only through the liquid density
+    double pc_i, dpc_i_dT, dpc_i_dp;
+    if (pc_i_->IsMolarBasis()) {
+      pc_i = pc_i_->CapillaryPressure(T, rho_l);
+      double dpc_i_drho = pc_i_->DCapillaryPressureDRho(T, rho_l);
+      dpc_i_dT = pc_i_->DCapillaryPressureDT(T, rho_l) + dpc_i_drho * drho_l_dT;
+      dpc_i_dp = dpc_i_drho * drho_l_dp;
+    } else {
+      double mass_rho_l = liquid_eos_->MassDensity(eos_param);
+      double dmass_rho_l_dT = liquid_eos_->DMassDensityDT(eos_param);
+      double dmass_rho_l_dp = liquid_eos_->DMassDensityDp(eos_param) * deff_p_dp;
+      pc_i = pc_i_->CapillaryPressure(T, mass_rho_l);
+      double dpc_i_drho = pc_i_->DCapillaryPressureDRho(T, mass_rho_l);
+      dpc_i_dT = pc_i_->DCapillaryPressureDT(T, mass_rho_l) + dpc_i_drho * dmass_rho_l_dT;
+      dpc_i_dp = dpc_i_drho * dmass_rho_l_dp;
+    }
+
+    double pc_l = pc_l_->CapillaryPressure(p, p_atm_);
+    double dpc_l_dp = pc_l_->DCapillaryPressureDp(p, p_atm_);
+
+    // saturations, in order gas, liquid, ice (gas is not used)
+    double sats[3], dsats_dpc_l[3], dsats_dpc_i[3];
+    wrm_->saturations(pc_l, pc_i, sats);
+    wrm_->dsaturations_dpc_liq(pc_l, pc_i, dsats_dpc_l);
+    wrm_->dsaturations_dpc_ice(pc_l, pc_i, dsats_dpc_i);
+    double ds_dT[3], ds_dp[3];
+    for (int k=0; k!=3; ++k) {
+      ds_dT[k] = dsats_dpc_i[k] * dpc_i_dT;
+      ds_dp[k] = dsats_dpc_l[k] * dpc_l_dp + dsats_dpc_i[k] * dpc_i_dp;
+    }
+
+    double u_l = liquid_iem_->InternalEnergy(T);
+    double du_l_dT = liquid_iem_->DInternalEnergyDT(T);
+    double u_i = ice_iem_->InternalEnergy(T);
+    double du_i_dT = ice_iem_->DInternalEnergyDT(T);
+
+    double u_rock = rock_iem_->InternalEnergy(T);
+    double du_rock_dT = rock_iem_->DInternalEnergyDT(T);
+
+    // molar density times saturation of each phase
+    double ns_l = rho_l * sats[1];
+    double dns_l_dT = drho_l_dT * sats[1] + rho_l * ds_dT[1];
+    double dns_l_dp = drho_l_dp * sats[1] + rho_l * ds_dp[1];
+    double ns_i = rho_i * sats[2];
+    double dns_i_dT = drho_i_dT * sats[2] + rho_i * ds_dT[2];
+    double dns_i_dp = drho_i_dp * sats[2] + rho_i * ds_dp[2];
+
+    // water content
+    double wc_pore = ns_l + ns_i;
+    result[1] = poro * wc_pore;
+    jac(1,0) = poro * (dns_l_dT + dns_i_dT);
+    jac(1,1) = dporo_dp * wc_pore + poro * (dns_l_dp + dns_i_dp);
+
+    // energy
+    double e_pore = u_l * ns_l + u_i * ns_i;
+    result[0] = poro * e_pore + (1.0 - poro_) * (rho_rock_ * u_rock);
+    jac(0,0) = poro * (du_l_dT * ns_l + u_l * dns_l_dT
+                       + du_i_dT * ns_i + u_i * dns_i_dT)
+        + (1.0 - poro_) * (rho_rock_ * du_rock_dT);
+    jac(0,1) = dporo_dp * e_pore
+        + poro * (u_l * dns_l_dp + u_i * dns_i_dp);
+  } catch (const Exceptions::Amanzi_exception& e) {
+    if (e.what() == std::string("Cut time step")) {
+      ierr = 1;
+    }
+  }
+
+  return ierr;
+}
+
 }
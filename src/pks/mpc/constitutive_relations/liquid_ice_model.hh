@@ -39,6 +39,7 @@ class LiquidIceModel : public EWCModelBase {
   virtual void InitializeModel(const Teuchos::Ptr<State>& S,
                                Teuchos::ParameterList& plist);
   virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c);
+  virtual std::vector<double> CellParameters();
   virtual bool Freezing(double T, double p);
   virtual int EvaluateSaturations(double T, double p,
                                   double& s_gas, double& s_liq, double& s_ice);
@@ -49,6 +50,10 @@ class LiquidIceModel : public EWCModelBase {
   int EvaluateEnergyAndWaterContent_(double T, double p,
           AmanziGeometry::Point& result);
 
+  // analytic derivatives of the chain of models
+  int EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+          AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
  protected:
   Teuchos::RCP<Flow::WRMPermafrostModelPartition> wrms_;
   Teuchos::RCP<Flow::WRMPermafrostModel> wrm_;
@@ -69,6 +74,8 @@ class LiquidIceModel : public EWCModelBase {
   double p_atm_;
   double poro_;
   double rho_rock_;
+  int wrm_index_;
+  int poro_index_;
   bool poro_leij_;
   Key domain;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
@@ -40,6 +40,7 @@ class PermafrostModel : public EWCModelBase {
   virtual void InitializeModel(const Teuchos::Ptr<State>& S,
                                Teuchos::ParameterList& plist);
   virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c);
+  virtual std::vector<double> CellParameters();
   virtual bool Freezing(double T, double p);
   virtual int EvaluateSaturations(double T, double p,
                                   double& s_gas, double& s_liq, double& s_ice);
@@ -50,6 +51,10 @@ class PermafrostModel : public EWCModelBase {
   int EvaluateEnergyAndWaterContent_(double T, double p,
           AmanziGeometry::Point& result);
 
+  // analytic derivatives of the chain of models
+  int EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+          AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
  protected:
   Teuchos::RCP<Flow::WRMPermafrostModelPartition> wrms_;
   Teuchos::RCP<Flow::WRMPermafrostModel> wrm_;
@@ -72,6 +77,8 @@ class PermafrostModel : public EWCModelBase {
   double p_atm_;
   double poro_;
   double rho_rock_;
+  int wrm_index_;
+  int poro_index_;
   bool poro_leij_;
   Key domain;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
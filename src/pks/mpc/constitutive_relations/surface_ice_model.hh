@@ -39,6 +39,12 @@ class SurfaceIceModel : public EWCModelBase {
   SurfaceIceModel() {}
   virtual void InitializeModel(const Teuchos::Ptr<State>& S, Teuchos::ParameterList& plist);
   virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c);
+  virtual std::vector<double> CellParameters() {
+    std::vector<double> params(2);
+    params[0] = p_atm_;
+    params[1] = gz_;
+    return params;
+  }
 
   virtual bool Freezing(double T, double p) { return T < 273.15; }
   virtual int EvaluateSaturations(double T, double p, double& s_gas, double& s_liq, double& s_ice) {
@@ -0,0 +1,98 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+#ifndef AMANZI_EWC_TEST_MODELS_HH_
+#define AMANZI_EWC_TEST_MODELS_HH_
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_water.hh"
+#include "eos_ice.hh"
+#include "eos_ideal_gas.hh"
+#include "vapor_pressure_water.hh"
+#include "wrm_van_genuchten.hh"
+#include "wrm_fpd_permafrost_model.hh"
+#include "pc_ice_water.hh"
+#include "pc_liq_atm.hh"
+#include "iem_linear.hh"
+#include "iem_water_vapor.hh"
+#include "compressible_porosity_model.hh"
+
+#include "permafrost_model.hh"
+#include "liquid_ice_model.hh"
+
+namespace Amanzi {
+
+//
+// EWC models for unit tests, built directly from their relations rather than
+// from the evaluators of a State.  Cells differ only in base porosity, which
+// UpdateModel() sets.
+//
+template<class Model>
+struct TestModel : public Model {
+  explicit TestModel(const std::vector<double>& base_poro) :
+      base_poro_(base_poro) {
+    Teuchos::ParameterList plist;
+
+    Teuchos::ParameterList vg_plist;
+    vg_plist.set("van Genuchten m", 0.2);
+    vg_plist.set("van Genuchten alpha", 5.e-4);
+    vg_plist.set("van Genuchten residual saturation", 0.1);
+    vg_plist.set("van Genuchten smoothing interval width", 0.0);
+    this->wrm_ = Teuchos::rcp(new Flow::WRMFPDPermafrostModel(plist));
+    this->wrm_->set_WRM(Teuchos::rcp(new Flow::WRMVanGenuchten(vg_plist)));
+
+    this->liquid_eos_ = Teuchos::rcp(new Relations::EOSWater(plist));
+    this->ice_eos_ = Teuchos::rcp(new Relations::EOSIce(plist));
+    this->pc_i_ = Teuchos::rcp(new Flow::PCIceWater(plist));
+    this->pc_l_ = Teuchos::rcp(new Flow::PCLiqAtm(plist));
+
+    Teuchos::ParameterList liquid_plist;
+    liquid_plist.set("heat capacity [J mol^-1 K^-1]", 76.0);
+    this->liquid_iem_ = Teuchos::rcp(new Energy::IEMLinear(liquid_plist));
+    Teuchos::ParameterList ice_plist;
+    ice_plist.set("heat capacity [J mol^-1 K^-1]", 37.7);
+    ice_plist.set("latent heat [J mol^-1]", -6007.8);
+    this->ice_iem_ = Teuchos::rcp(new Energy::IEMLinear(ice_plist));
+    Teuchos::ParameterList rock_plist;
+    rock_plist.set("heat capacity [J kg^-1 K^-1]", 620.0);
+    this->rock_iem_ = Teuchos::rcp(new Energy::IEMLinear(rock_plist));
+
+    Teuchos::ParameterList poro_plist;
+    poro_plist.set("pore compressibility [Pa^-1]", 1.e-9);
+    this->poro_model_ = Teuchos::rcp(new Flow::CompressiblePorosityModel(poro_plist));
+    this->poro_leij_ = false;
+
+    this->p_atm_ = 101325.;
+    this->rho_rock_ = 2170.;
+    this->poro_ = base_poro_[0];
+    this->wrm_index_ = 0;
+    this->poro_index_ = 0;
+  }
+
+  virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c) override {
+    this->poro_ = base_poro_[c];
+  }
+
+  using Model::EvaluateEnergyAndWaterContentAndJacobian_;
+  using EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_FD_;
+
+  std::vector<double> base_poro_;
+};
+
+
+struct TestPermafrostModel : public TestModel<PermafrostModel> {
+  explicit TestPermafrostModel(const std::vector<double>& base_poro) :
+      TestModel<PermafrostModel>(base_poro) {
+    Teuchos::ParameterList plist;
+    gas_eos_ = Teuchos::rcp(new Relations::EOSIdealGas(plist));
+    vpr_ = Teuchos::rcp(new Relations::VaporPressureWater(plist));
+    gas_iem_ = Teuchos::rcp(new Energy::IEMWaterVapor(plist));
+  }
+};
+
+typedef TestModel<LiquidIceModel> TestLiquidIceModel;
+
+} // namespace
+
+#endif
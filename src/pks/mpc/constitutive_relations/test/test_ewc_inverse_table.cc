@@ -0,0 +1,114 @@
+#include "UnitTest++.h"
+#include "TestReporterStdout.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "ewc_inverse_table.hh"
+#include "ewc_test_models.hh"
+
+using namespace Amanzi;
+
+//
+// Checks tabulated inverses against the Newton inverse, and their sharing.
+//
+
+Teuchos::ParameterList tableList() {
+  Teuchos::ParameterList plist;
+  plist.set("temperature range [K]", Teuchos::Array<double>(std::vector<double>{ 263., 283. }));
+  plist.set("pressure range [Pa]", Teuchos::Array<double>(std::vector<double>{ 50000., 100000. }));
+  plist.set("temperature tolerance [K]", 0.01);
+  plist.set("pressure tolerance [Pa]", 100.);
+  return plist;
+}
+
+
+TEST(EWC_INVERSE_TABLE_LOOKUP) {
+  TestLiquidIceModel model({ 0.4 });
+  Teuchos::ParameterList plist = tableList();
+  model.UpdateModel(Teuchos::null, 0);
+  EWCInverseTable table(model, Teuchos::null, 0, plist);
+  CHECK(table.num_trusted_cells() > 0);
+
+  // Lookups of states inside the table box, which are not table nodes, agree
+  // with Newton within the tolerances, up to interpolation error between the
+  // test points of a cell.
+  int nfound = 0;
+  for (int j=0; j!=13; ++j) {
+    for (int i=0; i!=13; ++i) {
+      double T0 = 263.3 + 19.4 * i / 12;
+      double p0 = 50500. + 49000. * j / 12;
+      double e, wc;
+      CHECK_EQUAL(0, model.Evaluate(T0, p0, e, wc));
+
+      double T_newton = T0 + 0.5, p_newton = p0 - 1000.;
+      if (model.InverseEvaluate(e, wc, T_newton, p_newton)) continue;
+
+      double T = -1., p = -1.;
+      if (table.Lookup(e, wc, T, p)) {
+        nfound++;
+        CHECK_CLOSE(T_newton, T, 4 * 0.01);
+        CHECK_CLOSE(p_newton, p, 4 * 100.);
+      } else {
+        CHECK_EQUAL(-1., T);
+        CHECK_EQUAL(-1., p);
+      }
+    }
+  }
+  CHECK(nfound > 0);
+}
+
+
+TEST(EWC_INVERSE_TABLE_OUTSIDE) {
+  TestLiquidIceModel model({ 0.4 });
+  Teuchos::ParameterList plist = tableList();
+  model.UpdateModel(Teuchos::null, 0);
+  EWCInverseTable table(model, Teuchos::null, 0, plist);
+
+  // states outside of the table box are never found
+  double e_lo, wc_lo, e_hi, wc_hi;
+  CHECK_EQUAL(0, model.Evaluate(250., 40000., e_lo, wc_lo));
+  CHECK_EQUAL(0, model.Evaluate(295., 100000., e_hi, wc_hi));
+  double T = -1., p = -1.;
+  CHECK(!table.Lookup(e_lo, wc_lo, T, p));
+  CHECK(!table.Lookup(e_hi, wc_hi, T, p));
+  CHECK(!table.Lookup(e_lo, wc_hi, T, p));
+  CHECK_EQUAL(-1., T);
+  CHECK_EQUAL(-1., p);
+}
+
+
+TEST(EWC_INVERSE_TABLE_SHARED) {
+  TestLiquidIceModel model({ 0.3, 0.5 });
+  Teuchos::ParameterList plist = tableList();
+
+  bool built;
+  model.UpdateModel(Teuchos::null, 0);
+  auto table0 = EWCInverseTable::Get("column", model, Teuchos::null, 0,
+          model.CellParameters(), plist, built);
+  CHECK(built);
+
+  // another model with the same parameters in the scope, e.g. another
+  // column, shares it
+  TestLiquidIceModel other({ 0.3 });
+  other.UpdateModel(Teuchos::null, 0);
+  auto table0_other = EWCInverseTable::Get("column", other, Teuchos::null, 0,
+          other.CellParameters(), plist, built);
+  CHECK(!built);
+  CHECK(table0.get() == table0_other.get());
+
+  // but not different parameters
+  model.UpdateModel(Teuchos::null, 1);
+  auto table1 = EWCInverseTable::Get("column", model, Teuchos::null, 1,
+          model.CellParameters(), plist, built);
+  CHECK(built);
+  CHECK(table0.get() != table1.get());
+
+  // nor another scope, e.g. a domain whose relations come from other specs
+  auto table0_domain = EWCInverseTable::Get("domain", other, Teuchos::null, 0,
+          other.CellParameters(), plist, built);
+  CHECK(built);
+  CHECK(table0.get() != table0_domain.get());
+}
@@ -0,0 +1,96 @@
+#include "UnitTest++.h"
+#include "TestReporterStdout.h"
+
+#include <cmath>
+#include <vector>
+
+#include "ewc_test_models.hh"
+
+using namespace Amanzi;
+
+//
+// Checks the analytic Jacobians of the EWC models against finite differences,
+// and the batched inverse against the pointwise inverse.
+//
+
+// unsaturated states, frozen and thawed, away from the freezing curve
+const std::vector<std::pair<double,double> > states = {
+  { 265., 95000. }, { 268., 90000. }, { 275., 95000. }, { 280., 99000. } };
+
+
+template<class Model>
+void checkJacobian(Model& model) {
+  for (const auto& state : states) {
+    AmanziGeometry::Point res(2), res_fd(2);
+    WhetStone::Tensor jac(2,2), jac_fd(2,2);
+    CHECK_EQUAL(0, model.EvaluateEnergyAndWaterContentAndJacobian_(
+        state.first, state.second, res, jac));
+    CHECK_EQUAL(0, model.EvaluateEnergyAndWaterContentAndJacobian_FD_(
+        state.first, state.second, res_fd, jac_fd));
+
+    CHECK_CLOSE(res_fd[0], res[0], 1.e-10 * std::abs(res_fd[0]));
+    CHECK_CLOSE(res_fd[1], res[1], 1.e-10 * std::abs(res_fd[1]));
+    for (int i=0; i!=2; ++i) {
+      for (int j=0; j!=2; ++j) {
+        CHECK_CLOSE(jac_fd(i,j), jac(i,j), 1.e-3 * std::abs(jac_fd(i,j)) + 1.e-12);
+      }
+    }
+  }
+}
+
+
+template<class Model>
+void checkInverseBatch(Model& model) {
+  // one cell per state, each with its own porosity
+  int n = states.size();
+  std::vector<int> cells(n);
+  std::vector<double> energy(n), wc(n), T(n), p(n);
+  for (int c=0; c!=n; ++c) {
+    cells[c] = c;
+    model.UpdateModel(Teuchos::null, c);
+    CHECK_EQUAL(0, model.Evaluate(states[c].first, states[c].second, energy[c], wc[c]));
+
+    // initial guesses, off the solution
+    T[c] = states[c].first + 1.5;
+    p[c] = states[c].second - 2000.;
+  }
+  std::vector<double> T_batch(T), p_batch(p);
+  std::vector<int> ierr(n), iters(n);
+  int nfailed = model.InverseEvaluateBatch(Teuchos::null, cells, energy.data(), wc.data(),
+          T_batch.data(), p_batch.data(), ierr.data(), iters.data());
+  CHECK_EQUAL(0, nfailed);
+
+  for (int c=0; c!=n; ++c) {
+    model.UpdateModel(Teuchos::null, c);
+    CHECK_EQUAL(0, model.InverseEvaluate(energy[c], wc[c], T[c], p[c]));
+
+    CHECK_EQUAL(0, ierr[c]);
+    CHECK(iters[c] > 0);
+    CHECK_CLOSE(T[c], T_batch[c], 1.e-8);
+    CHECK_CLOSE(p[c], p_batch[c], 1.e-4);
+    CHECK_CLOSE(states[c].first, T_batch[c], 1.e-4);
+    CHECK_CLOSE(states[c].second, p_batch[c], 1.);
+  }
+}
+
+
+TEST(PERMAFROST_MODEL_JACOBIAN) {
+  TestPermafrostModel model({ 0.4 });
+  checkJacobian(model);
+}
+
+TEST(LIQUID_ICE_MODEL_JACOBIAN) {
+  TestLiquidIceModel model({ 0.4 });
+  checkJacobian(model);
+}
+
+TEST(PERMAFROST_MODEL_INVERSE_BATCH) {
+  TestPermafrostModel model({ 0.3, 0.4, 0.5, 0.6 });
+  checkInverseBatch(model);
+}
+
+TEST(LIQUID_ICE_MODEL_INVERSE_BATCH) {
+  TestLiquidIceModel model({ 0.3, 0.4, 0.5, 0.6 });
+  checkInverseBatch(model);
+}
+
@@ -49,6 +49,7 @@ respective methods.
 
 #include "PK.hh"
 #include "PK_Factory.hh"
+#include "startup_profiler.hh"
 
 namespace Amanzi {
 
@@ -139,6 +140,7 @@ template <class PK_t>
 void MPC<PK_t>::Setup(const Teuchos::Ptr<State>& S) {
   for (typename SubPKList::iterator pk = sub_pks_.begin();
        pk != sub_pks_.end(); ++pk) {
+    StartupProfiler::Phase phase("PK: " + StartupProfiler::Label((*pk)->name()));
     (*pk)->Setup(S);
   }
 }
@@ -151,6 +153,7 @@ template <class PK_t>
 void MPC<PK_t>::Initialize(const Teuchos::Ptr<State>& S) {
   for (typename SubPKList::iterator pk = sub_pks_.begin();
        pk != sub_pks_.end(); ++pk) {
+    StartupProfiler::Phase phase("PK: " + StartupProfiler::Label((*pk)->name()));
     (*pk)->Initialize(S);
   }
 };
@@ -311,6 +314,7 @@ void MPC<PK_t>::init_(const Teuchos::RCP<State>& S,
 
     // create the PK
     std::string name_i = pk_order[i];
+    StartupProfiler::Phase phase("PK: " + StartupProfiler::Label(name_i));
     Teuchos::RCP<PK> pk_notype = pk_factory.CreatePK(name_i, pk_tree_, global_list_, S, pk_soln);
     Teuchos::RCP<PK_t> pk = Teuchos::rcp_dynamic_cast<PK_t>(pk_notype, true); 
     sub_pks_.push_back(pk);
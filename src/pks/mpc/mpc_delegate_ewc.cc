@@ -8,8 +8,12 @@ Author: Ethan Coon
 Interface for EWC, a helper class that does projections and preconditioners in
 energy/water-content space instead of temperature/pressure space.
 ------------------------------------------------------------------------- */
+#include <algorithm>
+#include <map>
+
 #include "FieldEvaluator.hh"
 #include "ewc_model.hh"
+#include "ewc_inverse_table.hh"
 #include "mpc_delegate_ewc.hh"
 
 namespace Amanzi {
@@ -20,7 +24,8 @@ namespace Amanzi {
 // Constructor
 // -----------------------------------------------------------------------------
 MPCDelegateEWC::MPCDelegateEWC(Teuchos::ParameterList& plist) :
-    plist_(Teuchos::rcpFromRef(plist)) {
+    plist_(Teuchos::rcpFromRef(plist)),
+    use_tables_(false) {
   // set up the VerboseObject
   std::string name = plist_->get<std::string>("PK name")+std::string(" EWC");
   vo_ = Teuchos::rcp(new VerboseObject(name, *plist_));
@@ -96,6 +101,9 @@ void MPCDelegateEWC::setup(const Teuchos::Ptr<State>& S) {
       cusp_size_T_thawing_ = plist_->get<double>("freeze-thaw cusp width (thawing) [K]", 0.);
     }
   }
+
+  // tabulated inverses are built at initialization
+  use_tables_ = plist_->isSublist("inverse table");
 }
 
 
@@ -127,6 +135,8 @@ void MPCDelegateEWC::initialize(const Teuchos::Ptr<State>& S) {
 
   // initialize the model, which grabs all needed models from state
   model_->InitializeModel(S, *plist_);
+
+  if (use_tables_) build_inverse_tables_(S);
 }
 
 
@@ -236,4 +246,155 @@ void MPCDelegateEWC::update_precon_ewc_(double t, Teuchos::RCP<const TreeVector>
   }
 }
 
+
+// -----------------------------------------------------------------------------
+// Batched inversion of energy and water content for T,p.
+// -----------------------------------------------------------------------------
+void MPCDelegateEWC::inverse_evaluate_(const std::string& name, Inversions_& inv) {
+  int ncells = inv.cells.size();
+  inv.ierr.resize(ncells);
+  inv.iters.resize(ncells);
+
+  // cells outside of the tables are inverted by Newton
+  Inversions_ newton;
+  std::vector<int> newton_index;
+  for (int i=0; i!=ncells; ++i) {
+    if (lookup_inverse_(inv.cells[i], inv.energy[i], inv.wc[i], inv.T[i], inv.p[i])) {
+      inv.ierr[i] = 0;
+      inv.iters[i] = 0;
+    } else {
+      newton.add(inv.cells[i], inv.rules[i], inv.energy[i], inv.wc[i], inv.T[i], inv.p[i]);
+      newton_index.push_back(i);
+    }
+  }
+  int nnewton = newton.cells.size();
+  int ntable = ncells - nnewton;
+
+  newton.ierr.resize(nnewton);
+  newton.iters.resize(nnewton);
+  int nfailed = model_->InverseEvaluateBatch(S_next_.ptr(), newton.cells,
+          newton.energy.data(), newton.wc.data(), newton.T.data(), newton.p.data(),
+          newton.ierr.data(), newton.iters.data());
+  for (int k=0; k!=nnewton; ++k) {
+    int i = newton_index[k];
+    inv.T[i] = newton.T[k];
+    inv.p[i] = newton.p[k];
+    inv.ierr[i] = newton.ierr[k];
+    inv.iters[i] = newton.iters[k];
+  }
+
+  // the verbosity level, unlike the output stream, is the same on all ranks
+  if (vo_->getVerbLevel() >= Teuchos::VERB_HIGH) {
+    int iters_total = 0;
+    int iters_max = 0;
+    for (int iters : inv.iters) {
+      if (iters > 0) {
+        iters_total += iters;
+        iters_max = std::max(iters_max, iters);
+      }
+    }
+    int counts_l[4] = { ncells, nfailed, iters_total, ntable };
+    int counts_g[4];
+    mesh_->get_comm()->SumAll(counts_l, counts_g, 4);
+    int iters_max_g;
+    mesh_->get_comm()->MaxAll(&iters_max, &iters_max_g, 1);
+
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "  EWC " << name << ": inverted " << counts_g[0] << " cells, "
+                 << counts_g[3] << " from tables, "
+                 << counts_g[1] << " failed, " << counts_g[2] << " Newton iterations (max "
+                 << iters_max_g << " in a cell)" << std::endl;
+    }
+  }
+}
+
+
+int MPCDelegateEWC::inverse_evaluate_(int c, double energy, double wc, double& T, double& p) {
+  if (lookup_inverse_(c, energy, wc, T, p)) return 0;
+  model_->UpdateModel(S_next_.ptr(), c);
+  return model_->InverseEvaluate(energy, wc, T, p);
+}
+
+
+// -----------------------------------------------------------------------------
+// Tabulated inversion of energy and water content for T,p.
+// -----------------------------------------------------------------------------
+void MPCDelegateEWC::build_inverse_tables_(const Teuchos::Ptr<State>& S) {
+  Teuchos::ParameterList& table_list = plist_->sublist("inverse table");
+  int max_tables = table_list.get<int>("maximum number of tables", 8);
+
+  // cell parameters identify relations only within a domain set, whose
+  // domains share their model specs
+  Key domain = plist_->get<std::string>("domain name", "domain");
+  Key scope = Keys::isDomainSet(domain) ? Keys::getDomainSetName(domain) : domain;
+
+  // group cells by their parameters, keeping a representative of each
+  int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  std::map<std::vector<double>, std::pair<int,int> > groups; // count, cell
+  std::vector<std::vector<double> > cell_params(ncells);
+  for (int c=0; c!=ncells; ++c) {
+    model_->UpdateModel(S, c);
+    cell_params[c] = model_->CellParameters();
+    if (cell_params[c].empty()) {
+      if (vo_->os_OK(Teuchos::VERB_LOW)) {
+        Teuchos::OSTab tab = vo_->getOSTab();
+        *vo_->os() << "EWC model does not provide cell parameters, inverse tables are not used."
+                   << std::endl;
+      }
+      return;
+    }
+    auto& group = groups.emplace(cell_params[c], std::make_pair(0, c)).first->second;
+    group.first++;
+  }
+
+  // tabulate the most common
+  std::vector<std::pair<int, std::vector<double> > > by_count;
+  for (const auto& group : groups) by_count.emplace_back(group.second.first, group.first);
+  std::stable_sort(by_count.begin(), by_count.end(),
+                   [](const std::pair<int, std::vector<double> >& a,
+                      const std::pair<int, std::vector<double> >& b) {
+                     return a.first > b.first; });
+  if ((int) by_count.size() > max_tables) by_count.resize(max_tables);
+
+  std::map<std::vector<double>, int> table_of_params;
+  int ncells_tabulated = 0;
+  for (const auto& entry : by_count) {
+    int c = groups[entry.second].second;
+    model_->UpdateModel(S, c);
+    table_of_params[entry.second] = tables_.size();
+    bool built;
+    tables_.push_back(EWCInverseTable::Get(scope, *model_, S, c, entry.second, table_list, built));
+    ncells_tabulated += entry.first;
+
+    if (built && vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+      const EWCInverseTable& table = *tables_.back();
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "EWC inverse table " << tables_.size()-1 << " (" << entry.first
+                 << " cells): " << table.num_trusted_cells() << " of " << table.num_cells()
+                 << " table cells trusted, " << table.num_inversions() << " inversions"
+                 << std::endl;
+    }
+  }
+
+  table_index_.assign(ncells, -1);
+  for (int c=0; c!=ncells; ++c) {
+    auto it = table_of_params.find(cell_params[c]);
+    if (it != table_of_params.end()) table_index_[c] = it->second;
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "EWC inverse tables: " << tables_.size() << " of " << groups.size()
+               << " parameter sets tabulated, covering " << ncells_tabulated << " of "
+               << ncells << " cells" << std::endl;
+  }
+}
+
+
+bool MPCDelegateEWC::lookup_inverse_(int c, double energy, double wc, double& T, double& p) const {
+  if (table_index_.empty() || table_index_[c] < 0) return false;
+  return tables_[table_index_[c]]->Lookup(energy, wc, T, p);
+}
+
 } // namespace
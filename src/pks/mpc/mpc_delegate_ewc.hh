@@ -72,6 +72,20 @@ provides the initial guess to the nonlinear solve.
     * `"energy key`" ``[string]`` **DOMAIN-energy**
     * `"cell volume key`" ``[string]`` **DOMAIN-cell_volume**
 
+    * `"inverse table`" ``[ewc-inverse-table-spec]`` **optional** If
+      provided, the inverse of the model is tabulated at initialization,
+      once for each distinct set of cell parameters (e.g. soil type, base
+      porosity).  Tables are shared by the delegates of the columns of a
+      domain set, which are built from the same model specs.  Inverses are then interpolated from the table,
+      falling back to Newton outside of the table's trusted cells.  Cell
+      parameters are those at initialization; tables do not follow later
+      changes, e.g. of atmospheric pressure.  In addition to the table
+      parameters, this list takes:
+
+      - `"maximum number of tables`" ``[int]`` **8** Tables are built for the
+        most common parameter sets only; cells with other parameters always
+        use Newton.
+
     INCLUDES
 
     - ``[debugger-spec]`` Uses a Debugger_
@@ -90,6 +104,7 @@ provides the initial guess to the nonlinear solve.
 namespace Amanzi {
 
 class EWCModel;
+class EWCInverseTable;
 
 class MPCDelegateEWC {
 
@@ -117,7 +132,38 @@ class MPCDelegateEWC {
 
   virtual void update_precon_ewc_(double t, Teuchos::RCP<const TreeVector> up, double h);
 
+  // Cells whose T,p are inverse evaluated together.  T and p hold the
+  // initial guess, and then the result.  rules records how the result of each
+  // cell is to be used.
+  struct Inversions_ {
+    std::vector<int> cells;
+    std::vector<int> rules;
+    std::vector<double> energy;
+    std::vector<double> wc;
+    std::vector<double> T;
+    std::vector<double> p;
+    std::vector<int> ierr;
+    std::vector<int> iters;
+
+    void add(int c, int rule, double energy_c, double wc_c, double T_c, double p_c) {
+      cells.push_back(c);
+      rules.push_back(rule);
+      energy.push_back(energy_c);
+      wc.push_back(wc_c);
+      T.push_back(T_c);
+      p.push_back(p_c);
+    }
+  };
+
+  // Inverts all cells of inv at once, reporting iterations and failures.
+  void inverse_evaluate_(const std::string& name, Inversions_& inv);
 
+  // Inverts a single cell, T and p are the initial guess on input.
+  int inverse_evaluate_(int c, double energy, double wc, double& T, double& p);
+
+  // Tabulated inverses, see "inverse table".
+  void build_inverse_tables_(const Teuchos::Ptr<State>& S);
+  bool lookup_inverse_(int c, double energy, double wc, double& T, double& p) const;
 
  protected:
   Teuchos::RCP<Teuchos::ParameterList> plist_;
@@ -127,6 +173,11 @@ class MPCDelegateEWC {
   // model
   Teuchos::RCP<EWCModel> model_;
 
+  // inverse tables, and the table of each cell (-1 if none)
+  bool use_tables_;
+  std::vector<Teuchos::RCP<const EWCInverseTable> > tables_;
+  std::vector<int> table_index_;
+
   enum PredictorType {
     PREDICTOR_NONE = 0,
     PREDICTOR_EWC,
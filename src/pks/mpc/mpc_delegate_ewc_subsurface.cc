@@ -25,6 +25,19 @@ energy/water-content space instead of temperature/pressure space.
 
 namespace Amanzi {
 
+namespace {
+
+// How the inverse of a cell is used, relative to the standard predictor or
+// correction.
+enum EWCRule {
+  EWC_ALWAYS = 0,       // always use it
+  EWC_ADMISSIBLE,       // use it if the temperature is admissible
+  EWC_LOWER_BRANCH_T,   // use it if it changes temperature less
+  EWC_LOWER_BRANCH_P    // use it if it changes pressure less
+};
+
+} // namespace
+
 
 bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<TreeVector> up) {
   Teuchos::OSTab tab = vo_->getOSTab();
@@ -79,6 +92,9 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
   const Epetra_MultiVector& cv = *S_next_->GetFieldData(cv_key_)
       ->ViewComponent("cell",false);
 
+  // Cells needing EWC are first collected, then inverted together, and
+  // finally each inverse is accepted or rejected.
+  Inversions_ inv;
   int rank = mesh_->get_comm()->MyPID();
   int ncells = wc0.MyLength();
   for (int c=0; c!=ncells; ++c) {
@@ -145,26 +161,8 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 
       } else {
         // -- invert for T,p at the projected ewc
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        inv.add(c, EWC_ADMISSIBLE, e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         ewc_completed = true;
-        if (ierr) {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-          // pass, keep the T,p projections
-        } else {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "     kept within the transition zone." << std::endl
-                        << "   p,T = " << p << ", " << T << std::endl;
-
-          // in the transition zone of latent heat exchange
-          if (T > 200.) {
-            temp_guess_c[0][c] = T;
-            pres_guess_c[0][c] = p;
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "       not admissible!" << std::endl;
-          }
-        }
       }
 #if EWC_THAWING
     } else { // increasing, thawing
@@ -182,30 +180,8 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 
       } else {
         // in the transition zone of latent heat exchange
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        inv.add(c, EWC_LOWER_BRANCH_T, e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         ewc_completed = true;
-        if (ierr) {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-          // pass, keep the T,p projections
-        } else {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "     kept within the transition zone." << std::endl
-                        << "   p,T = " << p << ", " << T << std::endl;
-
-          // two ways to get a projected T past freezing point:
-          //  -- be on the lower branch and overshoot (ewc results in smaller dT)
-          //  -- be on the middle branch and get over the hump (ewc results in much larger dT)
-          if (T - T_prev < temp_guess_c[0][c] - T_prev) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     dT_ewc < dT_std, on the lower branch, using EWC" << std::endl;
-            temp_guess_c[0][c] = T;
-            pres_guess_c[0][c] = p;
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     dT_ewc > dT_std, on the middle branch, use std prediction" << std::endl;
-          }
-        }
       }
 #endif
     }
@@ -229,25 +205,7 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 
         } else {
           // -- invert for T,p at the projected ewc
-          ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-            // pass, keep the T,p projections
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T = " << p << ", " << T << std::endl;
-
-            // in the transition zone of latent heat exchange
-            if (T > 200.) {
-              temp_guess_c[0][c] = T;
-              pres_guess_c[0][c] = p;
-            } else {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "       not admissible!" << std::endl;
-            }
-          }
+          inv.add(c, EWC_ADMISSIBLE, e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         }
 
 #if EWC_INCREASING_PRESSURE
@@ -266,29 +224,7 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 
         } else {
           // in the transition zone of latent heat exchange
-          ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-            // pass, keep the T,p projections
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T = " << p << ", " << T << std::endl;
-          
-            // two ways to get a projected p to saturated:
-            //  -- be on the lower branch and overshoot (ewc results in smaller dp)
-            //  -- be on the middle branch and get over the hump (ewc results in much larger dp)
-            if (p - p_prev < pres_guess_c[0][c] - p_prev) {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "     dp_ewc < dp_std, on the lower branch, using EWC" << std::endl;
-              temp_guess_c[0][c] = T;
-              pres_guess_c[0][c] = p;
-            } else {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "     dp_ewc > dp_std, on the middle branch, use std prediction" << std::endl;
-            }
-          }
+          inv.add(c, EWC_LOWER_BRANCH_P, e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         }
 #endif
       }
@@ -296,6 +232,71 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 #endif
 
   }
+
+  inverse_evaluate_("predictor", inv);
+
+  for (int i=0; i!=(int) inv.cells.size(); ++i) {
+    int c = inv.cells[i];
+    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
+    if (vo_->os_OK(Teuchos::VERB_EXTREME))
+      dcvo = db_->GetVerboseObject(c, rank);
+    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
+
+    if (inv.ierr[i]) {
+      if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+        *dcvo->os() << "FAILED EWC PREDICTOR: c = " << c << ", error " << inv.ierr[i] << std::endl;
+      // pass, keep the T,p projections
+      continue;
+    }
+
+    double T = inv.T[i];
+    double p = inv.p[i];
+    double T_prev = T1[0][c];
+    double p_prev = p1[0][c];
+    if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+      *dcvo->os() << "EWC predictor: c = " << c << ", kept within the transition zone in "
+                  << inv.iters[i] << " iterations." << std::endl
+                  << "   p,T = " << p << ", " << T << std::endl;
+
+    if (inv.rules[i] == EWC_ADMISSIBLE) {
+      // in the transition zone of latent heat exchange
+      if (T > 200.) {
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "       not admissible!" << std::endl;
+      }
+
+    } else if (inv.rules[i] == EWC_LOWER_BRANCH_T) {
+      // two ways to get a projected T past freezing point:
+      //  -- be on the lower branch and overshoot (ewc results in smaller dT)
+      //  -- be on the middle branch and get over the hump (ewc results in much larger dT)
+      if (T - T_prev < temp_guess_c[0][c] - T_prev) {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dT_ewc < dT_std, on the lower branch, using EWC" << std::endl;
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dT_ewc > dT_std, on the middle branch, use std prediction" << std::endl;
+      }
+
+    } else if (inv.rules[i] == EWC_LOWER_BRANCH_P) {
+      // two ways to get a projected p to saturated:
+      //  -- be on the lower branch and overshoot (ewc results in smaller dp)
+      //  -- be on the middle branch and get over the hump (ewc results in much larger dp)
+      if (p - p_prev < pres_guess_c[0][c] - p_prev) {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dp_ewc < dp_std, on the lower branch, using EWC" << std::endl;
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dp_ewc > dp_std, on the middle branch, use std prediction" << std::endl;
+      }
+    }
+  }
   return true;
 }
 
@@ -331,6 +332,9 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
   double dT_min = 0.01;
   double dp_min = 100.;
 
+  // Cells needing EWC are first collected, then inverted together, and
+  // finally each inverse is accepted or rejected.
+  Inversions_ inv;
   int rank = mesh_->get_comm()->MyPID();
   int ncells = cv.MyLength();
   for (int c=0; c!=ncells; ++c) {
@@ -377,9 +381,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
               - (jac_[c](0,0) * dp_std[0][c] + jac_[c](0,1) * dT_std[0][c]);
           double e_ewc = e_old[0][c]
               - (jac_[c](1,0) * dp_std[0][c] + jac_[c](1,1) * dT_std[0][c]);
-          bool verbose = false;
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-            verbose = true;
             *dcvo->os() << std::setprecision(14)
                         << "   Prev p,T: " << p_old[0][c] << ", " << T_old[0][c] << std::endl
                         << "   Prev wc,e: " << wc_old[0][c] << ", " << e_old[0][c] << std::endl
@@ -392,34 +394,8 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
           }
 
           // -- invert for T,p at the projected ewc
-          double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p, verbose);
+          inv.add(c, EWC_ALWAYS, e_ewc/cv[0][c], wc_ewc/cv[0][c], T_prev, p_old[0][c]);
           ewc_completed = true;
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-            // pass, keep the T,p projections
-
-          } else {
-            double dT_ewc = T_old[0][c] - T;
-            double dp_ewc = p_old[0][c] - p;
-
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T_ewc = " << p << ", " << T << std::endl
-                          << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-              if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-                *dcvo->os() << "  sufficient change" << std::endl;
-              } else {
-                *dcvo->os() << "  insufficient change, trying anyway" << std::endl;
-              }
-            }
-
-            //            if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-              dT_std[0][c] = dT_ewc;
-              dp_std[0][c] = dp_ewc;
-              //            }
-          }
         }
 
 #if EWC_PC_THAWING
@@ -452,39 +428,8 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
                         << "     wc,e_ewc = " << wc_ewc << ", " << e_ewc << std::endl;
 
           // -- invert for T,p at the projected ewc
-          double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p);
+          inv.add(c, EWC_LOWER_BRANCH_T, e_ewc/cv[0][c], wc_ewc/cv[0][c], T_prev, p_old[0][c]);
           ewc_completed = true;
-
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-            // pass, keep the T,p projections
-
-          } else {
-            double dT_ewc = T_old[0][c] - T;
-            double dp_ewc = p_old[0][c] - p;
-
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-              *dcvo->os() << "     within the transition zone." << std::endl
-                          << "   p,T_ewc = " << p << ", " << T << std::endl
-                          << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-              if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-                  (std::abs(dT_ewc) < std::abs(dT_std[0][c]))) {
-                *dcvo->os() << "  sufficient change, and decreased dT (and so on the lower branch), using EWC" << std::endl;
-              } else if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min)) {
-                *dcvo->os() << "  increased dT (and so on the middle branch), using std" << std::endl;
-              } else {
-                *dcvo->os() << "  insufficient change, trying anyway" << std::endl;
-              }
-            }
-
-            //            if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-            if (std::abs(dT_ewc) < std::abs(dT_std[0][c])) {
-              dT_std[0][c] = dT_ewc;
-              dp_std[0][c] = dp_ewc;
-            }
-          }
         }
 #endif
       }
@@ -512,9 +457,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
               - (jac_[c](0,0) * dp_std[0][c] + jac_[c](0,1) * dT_std[0][c]);
             double e_ewc = e_old[0][c]
               - (jac_[c](1,0) * dp_std[0][c] + jac_[c](1,1) * dT_std[0][c]);
-            bool verbose = false;
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-              verbose = true;
               *dcvo->os() << std::setprecision(14)
                           << "   Prev p,T: " << p_old[0][c] << ", " << T_old[0][c] << std::endl
                           << "   Prev wc,e: " << wc_old[0][c] << ", " << e_old[0][c] << std::endl
@@ -527,34 +470,8 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
             }
 
             // -- invert for T,p at the projected ewc
-            double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p, verbose);
+            inv.add(c, EWC_ALWAYS, e_ewc/cv[0][c], wc_ewc/cv[0][c], T_prev, p_old[0][c]);
             ewc_completed = true;
-            if (ierr) {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-              // pass, keep the T,p projections
-
-            } else {
-              double dT_ewc = T_old[0][c] - T;
-              double dp_ewc = p_old[0][c] - p;
-
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-                *dcvo->os() << "     kept within the transition zone." << std::endl
-                            << "   p,T_ewc = " << p << ", " << T << std::endl
-                            << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-                if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-                  *dcvo->os() << "  sufficient change" << std::endl;
-                } else {
-                  *dcvo->os() << "  insufficient change, taking anyway" << std::endl;
-                }
-              }
-
-              //              if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-                dT_std[0][c] = dT_ewc;
-                dp_std[0][c] = dp_ewc;
-                //              }
-            }
           }
 
 #if EWC_PC_INCREASING_PRESSURE          
@@ -587,40 +504,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
                           << "     wc,e_ewc = " << wc_ewc << ", " << e_ewc << std::endl;
 
             // -- invert for T,p at the projected ewc
-            double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p);
-
-            if (ierr) {
-              ewc_completed = true;
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-              // pass, keep the T,p projections
-
-            } else {
-              double dT_ewc = T_old[0][c] - T;
-              double dp_ewc = p_old[0][c] - p;
-
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-                *dcvo->os() << "     within the transition zone." << std::endl
-                            << "   p,T_ewc = " << p << ", " << T << std::endl
-                            << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-                if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-                    (std::abs(dp_ewc) < std::abs(dp_std[0][c]))) {
-                  *dcvo->os() << "  sufficient change, and decreased dp (and so on the lower branch), using EWC" << std::endl;
-                } else if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min)) {
-                  *dcvo->os() << "  increased dp (and so on the middle branch), using std" << std::endl;
-                } else {
-                  *dcvo->os() << "  insufficient change, taking anyway" << std::endl;
-                }
-              }
-
-              //              if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-              if (std::abs(dp_ewc) < std::abs(dp_std[0][c])) {
-                ewc_completed = true;
-                dT_std[0][c] = dT_ewc;
-                dp_std[0][c] = dp_ewc;
-              }
-            }
+            inv.add(c, EWC_LOWER_BRANCH_P, e_ewc/cv[0][c], wc_ewc/cv[0][c], T_prev, p_old[0][c]);
           }
 #endif          
         }
@@ -628,6 +512,50 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 #endif
     }
   }
+
+  inverse_evaluate_("preconditioner", inv);
+
+  for (int i=0; i!=(int) inv.cells.size(); ++i) {
+    int c = inv.cells[i];
+    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
+    if (vo_->os_OK(Teuchos::VERB_EXTREME))
+      dcvo = db_->GetVerboseObject(c, rank);
+    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
+
+    if (inv.ierr[i]) {
+      if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+        *dcvo->os() << "FAILED EWC PRECON: c = " << c << ", error " << inv.ierr[i] << std::endl;
+      // pass, keep the std correction
+      continue;
+    }
+
+    double dT_ewc = T_old[0][c] - inv.T[i];
+    double dp_ewc = p_old[0][c] - inv.p[i];
+
+    // take the EWC correction, or on a lower branch only if it is smaller
+    bool use_ewc = inv.rules[i] == EWC_ALWAYS ||
+                   (inv.rules[i] == EWC_LOWER_BRANCH_T && std::abs(dT_ewc) < std::abs(dT_std[0][c])) ||
+                   (inv.rules[i] == EWC_LOWER_BRANCH_P && std::abs(dp_ewc) < std::abs(dp_std[0][c]));
+
+    if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
+      *dcvo->os() << "EWC precon: c = " << c << ", within the transition zone in "
+                  << inv.iters[i] << " iterations." << std::endl
+                  << "   p,T_ewc = " << inv.p[i] << ", " << inv.T[i] << std::endl
+                  << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
+      if (!use_ewc) {
+        *dcvo->os() << "  increased change (and so on the middle branch), using std" << std::endl;
+      } else if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
+        *dcvo->os() << "  sufficient change, using EWC" << std::endl;
+      } else {
+        *dcvo->os() << "  insufficient change, trying anyway" << std::endl;
+      }
+    }
+
+    if (use_ewc) {
+      dT_std[0][c] = dT_ewc;
+      dp_std[0][c] = dp_ewc;
+    }
+  }
 }
 
 } // namespace
@@ -126,7 +126,7 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
         // pass, guesses are good
       } else {
         // -- invert for T,p at the projected ewc
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        ierr = inverse_evaluate_(c, e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         if (ierr) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
               *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
@@ -155,7 +155,7 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
         // pass, guesses are good
       } else {
         // in the transition zone of latent heat exchange
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        ierr = inverse_evaluate_(c, e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         if (ierr) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
             *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
@@ -248,7 +248,7 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
           // -- invert for T,p at the projected ewc
           double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c],
+          int ierr = inverse_evaluate_(c, e_ewc/cv[0][c], wc_ewc/cv[0][c],
                   T, p);
           if (ierr) {
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -311,7 +311,7 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
             // -- invert for T,p at the projected ewc
             double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c],
+            int ierr = inverse_evaluate_(c, e_ewc/cv[0][c], wc_ewc/cv[0][c],
                     T, p);
 
             if (!ierr && T < 273.15) {
@@ -420,10 +420,10 @@ MPCPermafrost::UpdatePreconditioner(double t,
   // done first (which is handled as they are listed first)
   MPCSubsurface::UpdatePreconditioner(t, up, h);
 
-  // Add the surface off-diagonal blocks.
+  // Add the surface off-diagonal blocks, unless they are being reused.
   // -- surface dWC/dT
   // -- dkr/dT
-  if (ddivq_dT_ != Teuchos::null) {
+  if (ddivq_dT_ != Teuchos::null && update_offdiagonal_) {
     // -- update and upwind d kr / dT
     S_next_->GetFieldEvaluator(surf_kr_key_)
       ->HasFieldDerivativeChanged(S_next_.ptr(), name_, surf_temp_key_);
@@ -446,7 +446,7 @@ MPCPermafrost::UpdatePreconditioner(double t,
     ddivq_dT_->ApplyBCs(false, true, false);
   }
 
-  if (precon_type_ != PRECON_NO_FLOW_COUPLING) {
+  if (precon_type_ != PRECON_NO_FLOW_COUPLING && update_offdiagonal_) {
     // -- surface dE_dp
     S_next_->GetFieldEvaluator(surf_e_key_)
       ->HasFieldDerivativeChanged(S_next_.ptr(), name_, surf_pres_key_);
@@ -463,10 +463,10 @@ MPCPermafrost::UpdatePreconditioner(double t,
   }
 
   // assemble
-  // -- scale the pressure dofs
+  // -- scale the pressure dofs, only in blocks that were rebuilt
   double scaling = 1.e6; // dWC/dp_Pa * (Pa / MPa) --> dWC/dp_MPa
-  sub_pks_[0]->preconditioner()->Rescale(scaling);
-  dE_dp_block_->Rescale(scaling);
+  if (update_diagonal_) sub_pks_[0]->preconditioner()->Rescale(scaling);
+  if (update_offdiagonal_) dE_dp_block_->Rescale(scaling);
 
   if (dump_) {
     preconditioner_->SymbolicAssembleMatrix();
@@ -90,6 +90,20 @@ MPCPermafrostSplitFluxColumns::MPCPermafrostSplitFluxColumns(Teuchos::ParameterL
   // init sub-pks
   plist_->set("PKs order", subpks);
   init_(S);
+
+  // optionally advance the columns concurrently
+  int nthreads = plist_->get<int>("column advance threads", 1);
+  if (nthreads > 1) {
+    if (ColumnThreadPool::IsSupported()) {
+      std::vector<std::string> task_pks;
+      for (int i=1; i!=sub_pks_.size(); ++i) task_pks.push_back(sub_pks_[i]->name());
+      ColumnThreadPool::CheckTasks("MPCPermafrostSplitFluxColumns", *pks_list_, task_pks);
+      thread_pool_ = Teuchos::rcp(new ColumnThreadPool(nthreads));
+    } else {
+      Errors::Message msg("MPCPermafrostSplitFluxColumns: \"column advance threads\" requires Trilinos built with Teuchos_ENABLE_THREAD_SAFE and MPI providing MPI_THREAD_MULTIPLE.");
+      Exceptions::amanzi_throw(msg);
+    }
+  }
 };
 
 
@@ -174,11 +188,19 @@ bool MPCPermafrostSplitFluxColumns::AdvanceStep(double t_old, double t_new, bool
   CopyStarToPrimary(t_new - t_old);
 
   // Now advance the primary
-  for (int i=1; i!=sub_pks_.size(); ++i) {
-    fail |= sub_pks_[i]->AdvanceStep(t_old, t_new, reinit);
-    if (fail) break;
-    fail |= !sub_pks_[i]->ValidStep();
-    if (fail) break;
+  if (thread_pool_ != Teuchos::null) {
+    int nfailed = thread_pool_->Run(sub_pks_.size()-1, [&](int i) {
+        bool fail_i = sub_pks_[i+1]->AdvanceStep(t_old, t_new, reinit);
+        return fail_i || !sub_pks_[i+1]->ValidStep();
+      });
+    fail = nfailed > 0;
+  } else {
+    for (int i=1; i!=sub_pks_.size(); ++i) {
+      fail |= sub_pks_[i]->AdvanceStep(t_old, t_new, reinit);
+      if (fail) break;
+      fail |= !sub_pks_[i]->ValidStep();
+      if (fail) break;
+    }
   }
 
   int fail_l(fail);
@@ -216,18 +238,14 @@ void
 MPCPermafrostSplitFluxColumns::CopyPrimaryToStar(const Teuchos::Ptr<const State>& S,
                                     const Teuchos::Ptr<State>& S_star)
 {
+  const auto& cols = GetColumnReadTable_(*S);
+
   // copy p primary variables into star primary variable
   auto& p_star = *S_star->GetFieldData(p_primary_variable_star_, S_star->GetField(p_primary_variable_star_)->owner())
                   ->ViewComponent("cell",false);
+  GatherColumns_(cols.p, p_star);
   for (int c=0; c!=p_star.MyLength(); ++c) {
-    Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-    const auto& p = *S->GetFieldData(pkey)->ViewComponent("cell",false);
-    AMANZI_ASSERT(p.MyLength() == 1);
-    if (p[0][0] <= 101325.0) {
-      p_star[0][c] = 101325.;
-    } else {
-      p_star[0][c] = p[0][0];
-    }
+    if (p_star[0][c] <= 101325.0) p_star[0][c] = 101325.;
   }
 
   auto peval = S_star->GetFieldEvaluator(p_primary_variable_star_);
@@ -237,12 +255,7 @@ MPCPermafrostSplitFluxColumns::CopyPrimaryToStar(const Teuchos::Ptr<const State>
   // copy T primary variable
   auto& T_star = *S_star->GetFieldData(T_primary_variable_star_, S_star->GetField(T_primary_variable_star_)->owner())
                   ->ViewComponent("cell",false);
-  for (int c=0; c!=p_star.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-    const auto& T = *S->GetFieldData(Tkey)->ViewComponent("cell",false);
-    AMANZI_ASSERT(T.MyLength() == 1);
-    T_star[0][c] = T[0][0];
-  }
+  GatherColumns_(cols.T, T_star);
 
   auto Teval = S_star->GetFieldEvaluator(T_primary_variable_star_);
   auto Teval_pvfe = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(Teval);
@@ -264,44 +277,26 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimary(double dt) {
 void
 MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
 {
+  auto& cols = GetColumnWriteTable_(*S_inter_);
+
   // copy p primary variables into star primary variable
   const auto& p_star = *S_next_->GetFieldData(p_primary_variable_star_)
                        ->ViewComponent("cell",false);
   for (int c=0; c!=p_star.MyLength(); ++c) {
     if (p_star[0][c] > 101325.0000001) {
-      Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-      auto& p = *S_inter_->GetFieldData(pkey, S_inter_->GetField(pkey)->owner())->ViewComponent("cell",false);
-      AMANZI_ASSERT(p.MyLength() == 1);
-      p[0][0] = p_star[0][c];
-
-      auto eval_p = S_inter_->GetFieldEvaluator(pkey);
-      auto eval_pv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_p);
-      AMANZI_ASSERT(eval_pv.get());
-      eval_pv->SetFieldAsChanged(S_inter_.ptr());
-
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], p_primary_variable_suffix_),
-                      S_inter_->GetField(Keys::getKey(col_domains_[c], p_primary_variable_suffix_))->owner()).ptr());
+      *cols.p[c] = p_star[0][c];
+      cols.p_eval[c]->SetFieldAsChanged(S_inter_.ptr());
+      CopySurfaceToSubsurface(*cols.p_surf[c], cols.p_sub[c].ptr());
     }
   }
 
   // copy p primary variables into star primary variable
   const auto& T_star = *S_next_->GetFieldData(T_primary_variable_star_)
                        ->ViewComponent("cell",false);
+  ScatterColumns_(T_star, cols.T);
   for (int c=0; c!=T_star.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-    auto& T = *S_inter_->GetFieldData(Tkey, S_inter_->GetField(Tkey)->owner())->ViewComponent("cell",false);
-    AMANZI_ASSERT(T.MyLength() == 1);
-    T[0][0] = T_star[0][c];
-
-    auto eval_p = S_inter_->GetFieldEvaluator(Tkey);
-    auto eval_pv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_p);
-    AMANZI_ASSERT(eval_pv.get());
-    eval_pv->SetFieldAsChanged(S_inter_.ptr());
-    
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                            S_inter_->GetFieldData(Keys::getKey(col_domains_[c], T_primary_variable_suffix_),
-                                    S_inter_->GetField(Keys::getKey(col_domains_[c], T_primary_variable_suffix_))->owner()).ptr());
+    cols.T_eval[c]->SetFieldAsChanged(S_inter_.ptr());
+    CopySurfaceToSubsurface(*cols.T_surf[c], cols.T_sub[c].ptr());
   }
 }
 
@@ -312,24 +307,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
 void
 MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
 {
-  // make sure we have the evaluator at the new state timestep
-  if (p_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key p_lf_key = Keys::getKey("surface_"+col_domain, p_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(p_lf_key);
-      p_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(p_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
-
-  if (T_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key T_lf_key = Keys::getKey("surface_"+col_domain, T_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(T_lf_key);
-      T_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(T_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
+  auto& cols_inter = GetColumnWriteTable_(*S_inter_);
+  auto& cols_next = GetColumnWriteTable_(*S_next_);
 
   // these updates should do nothing, but you never know
   S_inter_->GetFieldEvaluator(p_conserved_variable_star_)->HasFieldChanged(S_inter_.ptr(), name_);
@@ -369,54 +348,28 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
   for (int c=0; c!=p_star.MyLength(); ++c) {
     if (p_star[0][c] > 101325. && q_div[0][c] < 0.) {
       // use the Dirichlet
-      Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-      auto& p = *S_inter_->GetFieldData(pkey, S_inter_->GetField(pkey)->owner())->ViewComponent("cell",false);
-      AMANZI_ASSERT(p.MyLength() == 1);
-      p[0][0] = p_star[0][c];
-
-      Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-      auto& T = *S_inter_->GetFieldData(Tkey, S_inter_->GetField(Tkey)->owner())->ViewComponent("cell",false);
-      AMANZI_ASSERT(T.MyLength() == 1);
-      T[0][0] = T_star[0][c];
+      *cols_inter.p[c] = p_star[0][c];
+      *cols_inter.T[c] = T_star[0][c];
 
       // tag the evaluators as changed
-      auto eval_p = S_inter_->GetFieldEvaluator(pkey);
-      auto eval_pv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_p);
-      AMANZI_ASSERT(eval_pv.get());
-      eval_pv->SetFieldAsChanged(S_inter_.ptr());
-
-      auto eval_t = S_inter_->GetFieldEvaluator(Tkey);
-      auto eval_tv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_t);
-      AMANZI_ASSERT(eval_tv.get());
-      eval_tv->SetFieldAsChanged(S_inter_.ptr());
+      cols_inter.p_eval[c]->SetFieldAsChanged(S_inter_.ptr());
+      cols_inter.T_eval[c]->SetFieldAsChanged(S_inter_.ptr());
 
       // copy from surface to subsurface to ensure consistency
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-                              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], p_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(col_domains_[c], p_primary_variable_suffix_))->owner()).ptr());
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], T_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(col_domains_[c], T_primary_variable_suffix_))->owner()).ptr());
+      CopySurfaceToSubsurface(*cols_inter.p_surf[c], cols_inter.p_sub[c].ptr());
+      CopySurfaceToSubsurface(*cols_inter.T_surf[c], cols_inter.T_sub[c].ptr());
 
       // set the lateral flux to 0
-      Key p_lf_key = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0][0] = 0.;
-      p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
-
-      Key T_lf_key = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0][0] = 0.;
-      T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+      *cols_next.p_lf[c] = 0.;
+      *cols_next.T_lf[c] = 0.;
 
     } else { 
       // use flux
-      Key p_lf_key = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0][0] = q_div[0][c];
-      p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
-
-      Key T_lf_key = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0][0] = qE_div[0][c];
-      T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+      *cols_next.p_lf[c] = q_div[0][c];
+      *cols_next.T_lf[c] = qE_div[0][c];
     }
+    cols_next.p_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
+    cols_next.T_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
   }
 }
 
@@ -427,24 +380,7 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
 void
 MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
 {
-  // make sure we have the evaluator at the new state timestep
-  if (p_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key pkey = Keys::getKey("surface_"+col_domain, p_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(pkey);
-      p_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(p_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
-  
-  if (T_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key pkey = Keys::getKey("surface_"+col_domain, T_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(pkey);
-      T_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(T_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
+  auto& cols = GetColumnWriteTable_(*S_next_);
 
   // these updates should do nothing, but you never know
   S_inter_->GetFieldEvaluator(p_conserved_variable_star_)->HasFieldChanged(S_inter_.ptr(), name_);
@@ -463,11 +399,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
   q_div.ReciprocalMultiply(1.0, *S_next_->GetFieldData(cv_key_)->ViewComponent("cell",false), q_div, 0.);
 
   // copy into columns
-  for (int c=0; c!=q_div.MyLength(); ++c) {
-    Key pkey = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-    (*S_next_->GetFieldData(pkey, pkey)->ViewComponent("cell",false))[0][0] = q_div[0][c];
-    p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
-  }
+  ScatterColumns_(q_div, cols.p_lf);
+  for (const auto& eval : cols.p_lf_eval) eval->SetFieldAsChanged(S_next_.ptr());
   
   // grab the data, difference
   Epetra_MultiVector qE_div(*S_next_->GetFieldData(T_conserved_variable_star_)->ViewComponent("cell",false));
@@ -481,11 +414,107 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
   qE_div.ReciprocalMultiply(1.0, *S_next_->GetFieldData(cv_key_)->ViewComponent("cell",false), qE_div, 0.);
 
   // copy into columns
-  for (int c=0; c!=qE_div.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-    (*S_next_->GetFieldData(Tkey, Tkey)->ViewComponent("cell",false))[0][0] = qE_div[0][c];
-    T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+  ScatterColumns_(qE_div, cols.T_lf);
+  for (const auto& eval : cols.T_lf_eval) eval->SetFieldAsChanged(S_next_.ptr());
+}
+
+
+// -----------------------------------------------------------------------------
+// Resolve, once per State, the column fields read by CopyPrimaryToStar.
+// -----------------------------------------------------------------------------
+const MPCPermafrostSplitFluxColumns::ColumnReadTable&
+MPCPermafrostSplitFluxColumns::GetColumnReadTable_(const State& S)
+{
+  auto table = read_tables_.find(&S);
+  if (table != read_tables_.end()) return table->second;
+
+  auto& cols = read_tables_[&S];
+  for (const auto& col_domain : col_domains_) {
+    Key col_surf_domain = "surface_" + col_domain;
+    const auto& p = *S.GetFieldData(Keys::getKey(col_surf_domain, p_primary_variable_suffix_))
+                    ->ViewComponent("cell",false);
+    AMANZI_ASSERT(p.MyLength() == 1);
+    cols.p.push_back(p[0]);
+
+    const auto& T = *S.GetFieldData(Keys::getKey(col_surf_domain, T_primary_variable_suffix_))
+                    ->ViewComponent("cell",false);
+    AMANZI_ASSERT(T.MyLength() == 1);
+    cols.T.push_back(T[0]);
+  }
+  return cols;
+}
+
+
+// -----------------------------------------------------------------------------
+// Resolve, once per State, the column fields and evaluators written by
+// CopyStarToPrimary.
+// -----------------------------------------------------------------------------
+MPCPermafrostSplitFluxColumns::ColumnWriteTable&
+MPCPermafrostSplitFluxColumns::GetColumnWriteTable_(State& S)
+{
+  auto table = write_tables_.find(&S);
+  if (table != write_tables_.end()) return table->second;
+
+  auto& cols = write_tables_[&S];
+  for (const auto& col_domain : col_domains_) {
+    Key col_surf_domain = "surface_" + col_domain;
+
+    // primary variables on the column's surface and subsurface
+    Key pkey = Keys::getKey(col_surf_domain, p_primary_variable_suffix_);
+    auto p = S.GetFieldData(pkey, S.GetField(pkey)->owner());
+    AMANZI_ASSERT(p->ViewComponent("cell",false)->MyLength() == 1);
+    cols.p.push_back((*p->ViewComponent("cell",false))[0]);
+    cols.p_surf.push_back(p);
+    cols.p_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(S.GetFieldEvaluator(pkey)));
+    AMANZI_ASSERT(cols.p_eval.back() != Teuchos::null);
+
+    Key Tkey = Keys::getKey(col_surf_domain, T_primary_variable_suffix_);
+    auto T = S.GetFieldData(Tkey, S.GetField(Tkey)->owner());
+    AMANZI_ASSERT(T->ViewComponent("cell",false)->MyLength() == 1);
+    cols.T.push_back((*T->ViewComponent("cell",false))[0]);
+    cols.T_surf.push_back(T);
+    cols.T_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(S.GetFieldEvaluator(Tkey)));
+    AMANZI_ASSERT(cols.T_eval.back() != Teuchos::null);
+
+    Key p_sub_key = Keys::getKey(col_domain, p_primary_variable_suffix_);
+    cols.p_sub.push_back(S.GetFieldData(p_sub_key, S.GetField(p_sub_key)->owner()));
+    Key T_sub_key = Keys::getKey(col_domain, T_primary_variable_suffix_);
+    cols.T_sub.push_back(S.GetFieldData(T_sub_key, S.GetField(T_sub_key)->owner()));
+
+    // lateral flow sources
+    if (coupling_ != "pressure") {
+      Key p_lf_key = Keys::getKey(col_surf_domain, p_lateral_flow_source_suffix_);
+      cols.p_lf.push_back((*S.GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0]);
+      cols.p_lf_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(S.GetFieldEvaluator(p_lf_key)));
+      AMANZI_ASSERT(cols.p_lf_eval.back() != Teuchos::null);
+
+      Key T_lf_key = Keys::getKey(col_surf_domain, T_lateral_flow_source_suffix_);
+      cols.T_lf.push_back((*S.GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0]);
+      cols.T_lf_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(S.GetFieldEvaluator(T_lf_key)));
+      AMANZI_ASSERT(cols.T_lf_eval.back() != Teuchos::null);
+    }
   }
+  return cols;
+}
+
+
+void
+MPCPermafrostSplitFluxColumns::GatherColumns_(const std::vector<const double*>& cols,
+        Epetra_MultiVector& star)
+{
+  AMANZI_ASSERT(cols.size() == star.MyLength());
+  double* star_v = star[0];
+  for (int c=0; c!=cols.size(); ++c) star_v[c] = *cols[c];
+}
+
+
+void
+MPCPermafrostSplitFluxColumns::ScatterColumns_(const Epetra_MultiVector& star,
+        const std::vector<double*>& cols)
+{
+  AMANZI_ASSERT(cols.size() == star.MyLength());
+  const double* star_v = star[0];
+  for (int c=0; c!=cols.size(); ++c) *cols[c] = star_v[c];
 }
 
 // protected constructor of subpks
@@ -34,14 +34,22 @@ dE / dt = div (  kappa grad T) + hq )
 kappa grad T |_s = qE_ss
 
 
+
+If "column advance threads" is greater than 1, the column PKs are advanced
+concurrently after the star system; the column PKs must then run with
+"verbosity level" "none", see ColumnThreadPool.
+
 ------------------------------------------------------------------------- */
 
 #ifndef PKS_MPC_PERMAFROST_SPLIT_FLUX_COLUMNS_HH_
 #define PKS_MPC_PERMAFROST_SPLIT_FLUX_COLUMNS_HH_
 
+#include <map>
+
 #include "PK.hh"
 #include "mpc.hh"
 #include "primary_variable_field_evaluator.hh"
+#include "column_thread_pool.hh"
 
 namespace Amanzi {
 
@@ -87,6 +95,32 @@ class MPCPermafrostSplitFluxColumns : public MPC<PK> {
   virtual void CopyStarToPrimaryFlux_(double dt);
   virtual void CopyStarToPrimaryHybrid_(double dt);
 
+  // Per-column handles into a State, resolved once so that copies between
+  // the star system and the columns do not construct keys or look up fields
+  // and evaluators for every column on every step.  Column surface fields
+  // are a single cell, so handles are pointers to that cell's value.
+  struct ColumnReadTable {
+    std::vector<const double*> p, T;
+  };
+
+  struct ColumnWriteTable {
+    std::vector<double*> p, T;
+    std::vector<Teuchos::RCP<const CompositeVector> > p_surf, T_surf;
+    std::vector<Teuchos::RCP<CompositeVector> > p_sub, T_sub;
+    std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_eval, T_eval;
+
+    // only for flux and hybrid coupling
+    std::vector<double*> p_lf, T_lf;
+    std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_lf_eval, T_lf_eval;
+  };
+
+  const ColumnReadTable& GetColumnReadTable_(const State& S);
+  ColumnWriteTable& GetColumnWriteTable_(State& S);
+
+  // batched copies between a star system vector and the column cells
+  static void GatherColumns_(const std::vector<const double*>& cols, Epetra_MultiVector& star);
+  static void ScatterColumns_(const Epetra_MultiVector& star, const std::vector<double*>& cols);
+
  protected:
 
   Key p_primary_variable_suffix_;
@@ -100,11 +134,13 @@ class MPCPermafrostSplitFluxColumns : public MPC<PK> {
   Key T_lateral_flow_source_suffix_;
 
   Key cv_key_;
-  std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_eval_pvfes_;
-  std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > T_eval_pvfes_;
   std::vector<std::string> col_domains_;
 
+  std::map<const State*, ColumnReadTable> read_tables_;
+  std::map<const State*, ColumnWriteTable> write_tables_;
+
   std::string coupling_;
+  Teuchos::RCP<ColumnThreadPool> thread_pool_;
 
  private:
   // factory registration
@@ -10,6 +10,7 @@ with freezing.
 
 ------------------------------------------------------------------------- */
 #include "EpetraExt_RowMatrixOut.h"
+#include "Teuchos_TimeMonitor.hpp"
 
 #include "MultiplicativeEvaluator.hh"
 #include "TreeOperator.hh"
@@ -36,6 +37,14 @@ MPCSubsurface::MPCSubsurface(Teuchos::ParameterList& pk_tree_list,
                              const Teuchos::RCP<TreeVector>& soln) :
   PK(pk_tree_list, global_list, S, soln),
   StrongMPC<PK_PhysicalBDF_Default>(pk_tree_list, global_list, S, soln),
+  n_lagged_diagonal_(0),
+  n_lagged_offdiagonal_(0),
+  pc_valid_(false),
+  h_pc_(0.),
+  enorm_(0.),
+  enorm_prev_(0.),
+  update_diagonal_(true),
+  update_offdiagonal_(true),
   update_pcs_(0)
 {
   dump_ = plist_->get<bool>("dump preconditioner", false);
@@ -65,6 +74,22 @@ MPCSubsurface::MPCSubsurface(Teuchos::ParameterList& pk_tree_list,
   mass_flux_dir_key_ = Keys::readKey(*plist_, domain_name_, "mass flux direction", "mass_flux_direction");
   rho_key_ = Keys::readKey(*plist_, domain_name_, "mass density liquid", "mass_density_liquid");
 
+  // preconditioner lag
+  lag_diagonal_ = plist_->get<int>("preconditioner lag: diagonal blocks", 0);
+  lag_offdiagonal_ = plist_->get<int>("preconditioner lag: off-diagonal blocks", 0);
+  lag_across_steps_ = plist_->get<bool>("preconditioner lag: across timesteps", false);
+  lag_max_rate_ = plist_->get<double>("preconditioner lag: maximum contraction rate", 0.5);
+  if (lag_diagonal_ < 0 || lag_offdiagonal_ < 0) {
+    Errors::Message msg("MPCSubsurface: preconditioner lag must be non-negative.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  diagonal_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": PC diagonal blocks");
+  ddivq_dT_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": PC d div q / dT");
+  dWC_dT_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": PC dWC / dT");
+  ddivKgT_dp_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": PC d div K grad T / dp");
+  ddivhq_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": PC d div hq / dp,T");
+  dE_dp_timer_ = Teuchos::TimeMonitor::getNewCounter(name_+": PC dE / dp");
 }
 
 // -- Initialize owned (dependent) variables.
@@ -459,6 +484,11 @@ void MPCSubsurface::CommitStep(double t_old, double t_new, const Teuchos::RCP<St
     ewc_->commit_state(dt,S);
   }
   update_pcs_ = 0;
+
+  // convergence history does not carry over to the next step
+  enorm_ = 0.;
+  enorm_prev_ = 0.;
+  if (!lag_across_steps_) pc_valid_ = false;
 }
 
 
@@ -478,22 +508,78 @@ bool MPCSubsurface::ModifyPredictor(double h, Teuchos::RCP<const TreeVector> up0
 }
 
 
+// error norm, recording the convergence history.  This is the local norm, as
+// it is all that is computed when nested in another StrongMPC; the history is
+// reduced when it is used.
+double MPCSubsurface::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+        Teuchos::RCP<const TreeVector> du)
+{
+  double enorm = StrongMPC<PK_PhysicalBDF_Default>::ErrorNormLocal(u, du);
+  enorm_prev_ = enorm_;
+  enorm_ = enorm;
+  return enorm;
+}
+
+
+// -----------------------------------------------------------------------------
+// Decide which blocks to rebuild.  Everything is rebuilt if there is no valid
+// preconditioner, the timestep size has changed, or Newton is contracting
+// slowly; otherwise each set of blocks is rebuilt once it has been reused
+// its maximum number of times.
+// -----------------------------------------------------------------------------
+void MPCSubsurface::DecideLag_(double h)
+{
+  // all ranks must agree on whether to rebuild
+  double enorm_l[2] = { enorm_, enorm_prev_ };
+  double enorm_g[2];
+  solution_->Comm()->MaxAll(enorm_l, enorm_g, 2);
+  double rate = enorm_g[1] > 0. ? enorm_g[0] / enorm_g[1] : 0.;
+  bool rebuild = !pc_valid_ || std::abs(h - h_pc_) > 1.e-10 * std::abs(h)
+                 || rate > lag_max_rate_;
+
+  update_diagonal_ = rebuild || n_lagged_diagonal_ >= lag_diagonal_;
+  update_offdiagonal_ = rebuild || n_lagged_offdiagonal_ >= lag_offdiagonal_;
+  n_lagged_diagonal_ = update_diagonal_ ? 0 : n_lagged_diagonal_ + 1;
+  n_lagged_offdiagonal_ = update_offdiagonal_ ? 0 : n_lagged_offdiagonal_ + 1;
+
+  pc_valid_ = true;
+  h_pc_ = h;
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH))
+    *vo_->os() << "Precon update: diagonal blocks " << (update_diagonal_ ? "rebuilt" : "reused")
+               << ", off-diagonal blocks " << (update_offdiagonal_ ? "rebuilt" : "reused")
+               << " (contraction rate = " << rate << ")" << std::endl;
+}
+
+
 // updates the preconditioner
 void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
   Teuchos::OSTab tab = vo_->getOSTab();
 
+  update_diagonal_ = true;
+  update_offdiagonal_ = true;
   if (precon_type_ == PRECON_NONE) {
     // nothing to do
   } else if (precon_type_ == PRECON_BLOCK_DIAGONAL) {
     StrongMPC::UpdatePreconditioner(t,up,h);
   } else if (precon_type_ == PRECON_PICARD || precon_type_ == PRECON_EWC) {
-    preconditioner_->InitOffdiagonals(); // zero out offdiagonal blocks and mark for re-computation
-    StrongMPC::UpdatePreconditioner(t,up,h);
+    DecideLag_(h);
 
+    if (update_offdiagonal_) {
+      preconditioner_->InitOffdiagonals(); // zero out offdiagonal blocks and mark for re-computation
+    }
+    if (update_diagonal_) {
+      Teuchos::TimeMonitor monitor(*diagonal_timer_);
+      StrongMPC::UpdatePreconditioner(t,up,h);
+    }
+  }
+
+  if ((precon_type_ == PRECON_PICARD || precon_type_ == PRECON_EWC) && update_offdiagonal_) {
     // dWC / dT block
     // -- dkr/dT
     if (ddivq_dT_ != Teuchos::null) {
+      Teuchos::TimeMonitor monitor(*ddivq_dT_timer_);
       // -- update and upwind d kr / dT
       S_next_->GetFieldEvaluator(kr_key_)
           ->HasFieldDerivativeChanged(S_next_.ptr(), name_, temp_key_);
@@ -523,15 +609,19 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
     }
 
     // -- dWC/dT diagonal term
-    S_next_->GetFieldEvaluator(wc_key_)
-      ->HasFieldDerivativeChanged(S_next_.ptr(), name_, temp_key_);
-    Teuchos::RCP<const CompositeVector> dWC_dT =
-      S_next_->GetFieldData(Keys::getDerivKey(wc_key_, temp_key_));
-    dWC_dT_->AddAccumulationTerm(*dWC_dT, h, "cell", false);
+    Teuchos::RCP<const CompositeVector> dWC_dT;
+    {
+      Teuchos::TimeMonitor monitor(*dWC_dT_timer_);
+      S_next_->GetFieldEvaluator(wc_key_)
+        ->HasFieldDerivativeChanged(S_next_.ptr(), name_, temp_key_);
+      dWC_dT = S_next_->GetFieldData(Keys::getDerivKey(wc_key_, temp_key_));
+      dWC_dT_->AddAccumulationTerm(*dWC_dT, h, "cell", false);
+    }
 
     // dE / dp block
     // -- d Kappa / dp
     if (ddivKgT_dp_ != Teuchos::null) {
+      Teuchos::TimeMonitor monitor(*ddivKgT_dp_timer_);
       // Update and upwind thermal conductivity
       S_next_->GetFieldEvaluator(tc_key_)
           ->HasFieldDerivativeChanged(S_next_.ptr(), name_, pres_key_);
@@ -562,6 +652,7 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
 
     // -- d adv / dp   This one is a bit more complicated...
     if (ddivhq_dp_ != Teuchos::null) {
+      Teuchos::TimeMonitor monitor(*ddivhq_timer_);
       // Update and upwind enthalpy * kr * rho/mu
       // -- update values
       S_next_->GetFieldEvaluator(hkr_key_)
@@ -644,8 +735,11 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
       // -- update the local matrices, div h * kr grad
       ddivhq_dp_->UpdateMatrices(Teuchos::null, Teuchos::null);
       // -- determine the advective fluxes, q_a = h * kr grad p
-      CompositeVector adv_flux(*flux, INIT_MODE_ZERO);
-      Teuchos::Ptr<CompositeVector> adv_flux_ptr(&adv_flux);
+      if (adv_flux_ == Teuchos::null) {
+        adv_flux_ = Teuchos::rcp(new CompositeVector(*flux, INIT_MODE_ZERO));
+      }
+      adv_flux_->PutScalar(0.);
+      Teuchos::Ptr<CompositeVector> adv_flux_ptr = adv_flux_.ptr();
       ddivhq_dp_->UpdateFlux(up->SubVector(0)->Data().ptr(), adv_flux_ptr);
       // -- add in components div (d h*kr / dp) grad q_a / (h*kr)
       ddivhq_dp_->UpdateMatricesNewtonCorrection(adv_flux_ptr, up->SubVector(0)->Data().ptr());
@@ -661,11 +755,14 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
     }
 
     // -- dE/dp diagonal term
-    S_next_->GetFieldEvaluator(e_key_)
-        ->HasFieldDerivativeChanged(S_next_.ptr(), name_, pres_key_);
-    Teuchos::RCP<const CompositeVector> dE_dp =
-      S_next_->GetFieldData(Keys::getDerivKey(e_key_, pres_key_));
-    dE_dp_->AddAccumulationTerm(*dE_dp, h, "cell", false);
+    Teuchos::RCP<const CompositeVector> dE_dp;
+    {
+      Teuchos::TimeMonitor monitor(*dE_dp_timer_);
+      S_next_->GetFieldEvaluator(e_key_)
+          ->HasFieldDerivativeChanged(S_next_.ptr(), name_, pres_key_);
+      dE_dp = S_next_->GetFieldData(Keys::getDerivKey(e_key_, pres_key_));
+      dE_dp_->AddAccumulationTerm(*dE_dp, h, "cell", false);
+    }
 
     // write for debugging
     std::vector<std::string> vnames;
@@ -104,6 +104,15 @@ except in expert cases or for comparison's sake, but the options are:
   hope.
 
 
+Assembling the off-diagonal blocks, which requires upwinding derivatives
+of relative permeability, thermal conductivity, and enthalpy, can cost more
+than the linear solve itself.  The `"preconditioner lag`" options allow
+blocks to be reused across Newton iterations (and optionally timesteps),
+which is reasonable as long as Newton is still contracting well.  Blocks are
+always rebuilt when the timestep size changes, as the accumulation terms
+scale with it.  Time spent assembling each block is reported in the timer
+summary at the end of the run.
+
 Note this "ewc" algorithm is just as valid, and more useful, in the predictor
 (where it is not deprecated/disabled).  There, we extrapolate a change in
 pressure and temperature, but often do better to extrapolate in water content
@@ -124,6 +133,20 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
     * `"supress Jacobian terms: d div q / dT`" ``[bool]`` **false** If using picard or ewc, do not include this block in the preconditioner.
     * `"supress Jacobian terms: d div K grad T / dp`" ``[bool]`` **false** If using picard or ewc, do not include this block in the preconditioner.
 
+    * `"preconditioner lag: diagonal blocks`" ``[int]`` **0** If using picard
+      or ewc, reuse the diagonal (flow and energy) blocks for up to this many
+      consecutive preconditioner updates before rebuilding them.
+    * `"preconditioner lag: off-diagonal blocks`" ``[int]`` **0** If using
+      picard or ewc, reuse the off-diagonal blocks for up to this many
+      consecutive preconditioner updates before rebuilding them.
+    * `"preconditioner lag: across timesteps`" ``[bool]`` **false** If true,
+      lagged blocks may be reused in the next timestep, provided the timestep
+      size has not changed.  Otherwise all blocks are rebuilt at the start of
+      each timestep.
+    * `"preconditioner lag: maximum contraction rate`" ``[double]`` **0.5**
+      Lagged blocks are rebuilt whenever the ratio of the last two error
+      norms exceeds this, i.e. when Newton is no longer converging quickly.
+
     * `"ewc delegate`" ``[mpc-delegate-ewc-spec]`` A `EWC Globalization Delegate`_ spec.
 
     INCLUDES:
@@ -135,6 +158,8 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 #ifndef MPC_SUBSURFACE_HH_
 #define MPC_SUBSURFACE_HH_
 
+#include "Teuchos_Time.hpp"
+
 #include "TreeOperator.hh"
 #include "pk_physical_bdf_default.hh"
 #include "strong_mpc.hh"
@@ -182,6 +207,10 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
 
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
+  // error norm, monitored to decide when lagged blocks must be rebuilt
+  virtual double ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                                Teuchos::RCP<const TreeVector> du);
+
   // preconditioner application
   virtual int ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu);
   Teuchos::RCP<Operators::TreeOperator> preconditioner() { return preconditioner_; }
@@ -232,6 +261,34 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> ddivhq_dT_;
   Teuchos::RCP<Operators::UpwindTotalFlux> upwinding_dhkr_dT_;
 
+  // advective flux used in the d ( div hq ) terms
+  Teuchos::RCP<CompositeVector> adv_flux_;
+
+  // preconditioner lag policy
+  // -- decides which blocks the current update rebuilds, setting
+  //    update_diagonal_ and update_offdiagonal_
+  void DecideLag_(double h);
+  int lag_diagonal_;
+  int lag_offdiagonal_;
+  bool lag_across_steps_;
+  double lag_max_rate_;
+  int n_lagged_diagonal_;
+  int n_lagged_offdiagonal_;
+  bool pc_valid_;
+  double h_pc_;
+  double enorm_;
+  double enorm_prev_;
+  bool update_diagonal_;
+  bool update_offdiagonal_;
+
+  // assembly timers, per block
+  Teuchos::RCP<Teuchos::Time> diagonal_timer_;
+  Teuchos::RCP<Teuchos::Time> ddivq_dT_timer_;
+  Teuchos::RCP<Teuchos::Time> dWC_dT_timer_;
+  Teuchos::RCP<Teuchos::Time> ddivKgT_dp_timer_;
+  Teuchos::RCP<Teuchos::Time> ddivhq_timer_;
+  Teuchos::RCP<Teuchos::Time> dE_dp_timer_;
+
   // friend sub-pk Richards (need K_, some flags from private data)
   Teuchos::RCP<Flow::Richards> richards_pk_;
 
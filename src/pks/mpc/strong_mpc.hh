@@ -70,6 +70,8 @@ public:
   // -- enorm for the coupled system
   virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du);
+  virtual double ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                       Teuchos::RCP<const TreeVector> du);
 
   // StrongMPC's preconditioner is, by default, just the block-diagonal
   // operator formed by placing the sub PK's preconditioners on the diagonal.
@@ -259,11 +261,22 @@ int StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuch
 
 // -----------------------------------------------------------------------------
 // Compute a norm on u-du and returns the result.
-// For a Strong MPC, the enorm is just the max of the sub PKs enorms.
+// For a Strong MPC, the enorm is just the max of the sub PKs enorms.  The
+// sub-PK norms are computed locally and reduced once, here.
 // -----------------------------------------------------------------------------
 template<class PK_t>
 double StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u,
                         Teuchos::RCP<const TreeVector> du){
+  double norm_l = ErrorNormLocal(u, du);
+  double norm = 0.0;
+  du->Comm()->MaxAll(&norm_l, &norm, 1);
+  return norm;
+};
+
+
+template<class PK_t>
+double StrongMPC<PK_t>::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                        Teuchos::RCP<const TreeVector> du){
   double norm = 0.0;
 
   // loop over sub-PKs
@@ -283,7 +296,7 @@ double StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     }
 
     // norm is the max of the sub-PK norms
-    double tmp_norm = sub_pks_[i]->ErrorNorm(pk_u, pk_du);
+    double tmp_norm = sub_pks_[i]->ErrorNormLocal(pk_u, pk_du);
     norm = std::max(norm, tmp_norm);
   }
   return norm;
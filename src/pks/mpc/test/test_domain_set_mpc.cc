@@ -0,0 +1,42 @@
+#include "UnitTest++.h"
+#include "TestReporterStdout.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "DomainSetMPC.hh"
+
+using namespace Amanzi;
+
+//
+// Checks the domains restored for each sub-PK of a subcycled DomainSetMPC,
+// which are indexed as the sub-PKs, including any listed before the domain
+// set.
+//
+
+TEST(DOMAIN_SET_MPC_SUB_PK_DOMAINS_LEADING_PK) {
+  std::set<std::string> meshes = { "snow", "column_0", "surface_column_0",
+                                   "column_1", "surface_column_1", "snow_column_1" };
+  auto has_mesh = [&meshes](const std::string& domain) { return meshes.count(domain) > 0; };
+
+  // a leading PK on "snow", one without a domain, then the domain set
+  std::vector<std::string> domains = { "snow", "", "column_0", "column_1" };
+  auto sub_pk_domains = DomainSetMPC::SubPKDomains(domains, has_mesh);
+
+  CHECK_EQUAL(4, sub_pk_domains.size());
+  CHECK(sub_pk_domains[0] == std::vector<std::string>({ "snow" }));
+  CHECK(sub_pk_domains[1].empty());
+  CHECK(sub_pk_domains[2] == std::vector<std::string>({ "column_0", "surface_column_0" }));
+  CHECK(sub_pk_domains[3] == std::vector<std::string>({ "column_1", "surface_column_1", "snow_column_1" }));
+}
+
+
+TEST(DOMAIN_SET_MPC_SUB_PK_DOMAINS_SET_ONLY) {
+  auto has_mesh = [](const std::string& domain) { return domain.find("surface_") == 0; };
+  std::vector<std::string> domains = { "column_0", "column_1" };
+  auto sub_pk_domains = DomainSetMPC::SubPKDomains(domains, has_mesh);
+
+  CHECK_EQUAL(2, sub_pk_domains.size());
+  CHECK(sub_pk_domains[1] == std::vector<std::string>({ "column_1", "surface_column_1" }));
+}
@@ -98,6 +98,14 @@ class PK_BDF_Default : public PK_BDF {
   // -- Check the admissibility of a solution.
   virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) { return true; }
 
+  // -- Error norm on this process only, so that couplers may reduce the norms
+  //    of all of their sub-PKs in a single collective.  The default is the
+  //    (global) ErrorNorm().
+  virtual double ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+          Teuchos::RCP<const TreeVector> du) {
+    return ErrorNorm(u, du);
+  }
+
   // -- Possibly modify the predictor that is going to be used as a
   //    starting value for the nonlinear solve in the time integrator.
   virtual bool ModifyPredictor(double h, Teuchos::RCP<const TreeVector> up,
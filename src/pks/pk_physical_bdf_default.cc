@@ -69,6 +69,24 @@ void PK_PhysicalBDF_Default::Initialize(const Teuchos::Ptr<State>& S)
 // -----------------------------------------------------------------------------
 double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
         Teuchos::RCP<const TreeVector> res)
+{
+  double enorm_val_l = ErrorNormLocal(u, res);
+
+  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
+  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
+    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
+  const MPI_Comm& comm = mpi_comm_p->Comm();
+
+  double enorm_val = 0.0;
+  int ierr;
+  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
+  AMANZI_ASSERT(!ierr);
+  return enorm_val;
+};
+
+
+double PK_PhysicalBDF_Default::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+        Teuchos::RCP<const TreeVector> res)
 {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
@@ -87,12 +105,8 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_next_->time() - S_inter_->time();
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
   double enorm_val = 0.0;
+  std::vector<ENorm_t> enorms;
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
@@ -115,14 +129,14 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
+      const std::vector<int>& face_cells = FaceCells_();
 
       for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ? conserved[0][cells[0]]
-            : std::min(conserved[0][cells[0]],conserved[0][cells[1]]);
+        int c0 = face_cells[2*f];
+        int c1 = face_cells[2*f+1];
+        double cv_min = c1 < 0 ? cv[0][c0] : std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = c1 < 0 ? conserved[0][c0]
+            : std::min(conserved[0][c0], conserved[0][c1]);
 
         double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f])
             / (atol_*cv_min + rtol_*std::abs(conserved_min));
@@ -138,33 +152,81 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       //      AMANZI_ASSERT(norm < 1.e-15);
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
+    ENorm_t err;
+    err.value = enorm_comp;
+    err.gid = enorm_loc;
+    enorms.push_back(err);
+    enorm_val = std::max(enorm_val, enorm_comp);
+  }
 
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
+  // Write out Inf norms too.
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) WriteErrorNorms_(*dvec, enorms);
+  return enorm_val;
+};
 
-      int ierr;
 
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
+// -----------------------------------------------------------------------------
+// Face to cell adjacency used in error norms.
+// -----------------------------------------------------------------------------
+const std::vector<int>& PK_PhysicalBDF_Default::FaceCells_()
+{
+  int nfaces = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  if (face_cells_list_.size() != 2*(std::size_t) nfaces) {
+    face_cells_list_.resize(2*nfaces);
+    AmanziMesh::Entity_ID_List cells;
+    for (int f=0; f!=nfaces; ++f) {
+      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
+      face_cells_list_[2*f] = cells[0];
+      face_cells_list_[2*f+1] = cells.size() == 1 ? -1 : cells[1];
     }
+  }
+  return face_cells_list_;
+}
 
-    enorm_val = std::max(enorm_val, enorm_comp);
+
+// -----------------------------------------------------------------------------
+// Reduce and write the per-component error norms.
+// -----------------------------------------------------------------------------
+void PK_PhysicalBDF_Default::WriteErrorNorms_(const CompositeVector& dvec,
+        std::vector<ENorm_t>& enorms)
+{
+  // pack the (norm, location) and (inf norm, -) pairs of all components into
+  // one MAXLOC reduction
+  int ncomps = enorms.size();
+  std::vector<ENorm_t> l_err(2*ncomps), err(2*ncomps);
+  int i = 0;
+  for (CompositeVector::name_iterator comp=dvec.begin();
+       comp!=dvec.end() && i!=ncomps; ++comp, ++i) {
+    const Epetra_MultiVector& dvec_v = *dvec.ViewComponent(*comp, false);
+    l_err[2*i].value = enorms[i].value;
+    l_err[2*i].gid = enorms[i].gid < 0 ? -1 : dvec_v.Map().GID(enorms[i].gid);
+
+    double infnorm = 0.;
+    for (int k=0; k!=dvec_v.NumVectors(); ++k) {
+      for (int j=0; j!=dvec_v.MyLength(); ++j) {
+        infnorm = std::max(infnorm, std::abs(dvec_v[k][j]));
+      }
+    }
+    l_err[2*i+1].value = infnorm;
+    l_err[2*i+1].gid = 0;
   }
 
-  double enorm_val_l = enorm_val;
+  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
+  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
+    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
+  const MPI_Comm& comm = mpi_comm_p->Comm();
 
   int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
+  ierr = MPI_Allreduce(l_err.data(), err.data(), 2*ncomps, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
   AMANZI_ASSERT(!ierr);
-  return enorm_val;
-};
+
+  i = 0;
+  for (CompositeVector::name_iterator comp=dvec.begin();
+       comp!=dvec.end() && i!=ncomps; ++comp, ++i) {
+    *vo_->os() << "  ENorm (" << *comp << ") = " << err[2*i].value << "[" << err[2*i].gid
+               << "] (" << err[2*i+1].value << ")" << std::endl;
+  }
+}
 
 
   // void PK_PhysicalBDF_Default::Solution_to_State(TreeVector& solution,
@@ -101,9 +101,12 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default,
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h) override {}
 
   // Default implementations of BDFFnBase methods.
-  // -- Compute a norm on u-du and return the result.
+  // -- Compute a norm on u-du and return the result.  This is the global max
+  //    of ErrorNormLocal(), which is what derived PKs should override.
   virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du) override;
+  virtual double ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+          Teuchos::RCP<const TreeVector> du) override;
 
   virtual bool ValidStep() override {
     return PK_Physical_Default::ValidStep() && PK_BDF_Default::ValidStep();
@@ -125,6 +128,17 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default,
   std::vector<double>& bc_values() { return bc_->bc_value(); }
   Teuchos::RCP<Operators::BCs> BCs() { return bc_; }
 
+ protected:
+  // Cells of each owned face, two per face, the second being -1 if the face
+  // has only one owned cell.  Built on first use.
+  const std::vector<int>& FaceCells_();
+
+  // Writes the per-component error norms, their locations, and the inf norm
+  // of each component of the residual, with a single reduction.  enorms[i]
+  // is this process's max norm in the i-th component of dvec, with gid set
+  // to its local index (or -1).
+  void WriteErrorNorms_(const CompositeVector& dvec, std::vector<ENorm_t>& enorms);
+
  protected:
   // PC
   Teuchos::RCP<Operators::Operator> preconditioner_;
@@ -137,6 +151,9 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default,
   Key cell_vol_key_;
   double atol_, rtol_, fluxtol_;
 
+ private:
+  std::vector<int> face_cells_list_;
+
 };
 
 
@@ -0,0 +1,258 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Hierarchical wall time and memory profile of simulation startup.
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "Epetra_Comm.h"
+
+#include "errors.hh"
+#include "startup_profiler.hh"
+
+namespace Amanzi {
+
+namespace {
+
+double wallTime()
+{
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string escapeJSON(const std::string& str)
+{
+  std::string escaped;
+  for (char c : str) {
+    if (c == '"' || c == '\\') escaped.push_back('\\');
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+
+} // namespace
+
+
+StartupProfiler& StartupProfiler::Instance()
+{
+  static StartupProfiler profiler;
+  return profiler;
+}
+
+
+StartupProfiler::StartupProfiler() :
+    current_(0),
+    enabled_(false)
+{
+  // the root, which accumulates its children
+  nodes_.push_back(Node_{"startup", -1, {}, 1, 0., 0., 0., 0.});
+}
+
+
+void StartupProfiler::Start(const std::string& name)
+{
+  int n = -1;
+  for (int child : nodes_[current_].children) {
+    if (nodes_[child].name == name) {
+      n = child;
+      break;
+    }
+  }
+  if (n < 0) {
+    n = nodes_.size();
+    nodes_.push_back(Node_{name, current_, {}, 0, 0., 0., 0., 0.});
+    nodes_[current_].children.push_back(n);
+  }
+
+  Node_& node = nodes_[n];
+  node.count++;
+  node.time_start = wallTime();
+  node.memory_start = ResidentMemory();
+  current_ = n;
+}
+
+
+void StartupProfiler::Stop()
+{
+  if (current_ == 0) {
+    Errors::Message msg("StartupProfiler: Stop() called with no open phase.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  Node_& node = nodes_[current_];
+  double time = wallTime() - node.time_start;
+  double memory = ResidentMemory() - node.memory_start;
+  node.time += time;
+  node.memory += memory;
+  current_ = node.parent;
+  if (current_ == 0) {
+    nodes_[0].time += time;
+    nodes_[0].memory += memory;
+  }
+}
+
+
+std::string StartupProfiler::Label(const std::string& name)
+{
+  auto begin = name.find(':');
+  if (begin == std::string::npos) return name;
+  auto end = name.find('-', begin);
+  return name.substr(0, begin+1) + "*" + (end == std::string::npos ? "" : name.substr(end));
+}
+
+
+double StartupProfiler::ResidentMemory()
+{
+  // current resident set size, where available
+  std::ifstream statm("/proc/self/statm");
+  long pages_total, pages_resident;
+  if (statm >> pages_total >> pages_resident) {
+    return static_cast<double>(pages_resident) * sysconf(_SC_PAGESIZE) / 1024.0 / 1024.0;
+  }
+
+  // otherwise the high water mark
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#if (defined(__APPLE__) || defined(__MACH__))
+  return static_cast<double>(usage.ru_maxrss)/1024.0/1024.0;
+#else
+  return static_cast<double>(usage.ru_maxrss)/1024.0;
+#endif
+}
+
+
+double StartupProfiler::DomainSetMemory(const std::string& ds_name) const
+{
+  std::string label = ds_name + ":*";
+  auto is_subdomain = [&label](const std::string& name) {
+    auto pos = name.find(label);
+    return pos != std::string::npos && (pos == 0 || name[pos-1] == ' ');
+  };
+
+  double memory = 0.;
+  std::vector<int> stack(nodes_[0].children);
+  while (!stack.empty()) {
+    const Node_& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (is_subdomain(node.name)) {
+      memory += node.memory;
+    } else {
+      stack.insert(stack.end(), node.children.begin(), node.children.end());
+    }
+  }
+  return memory;
+}
+
+
+std::string StartupProfiler::Path_(int n) const
+{
+  std::string path = nodes_[n].name;
+  for (int p = nodes_[n].parent; p >= 0; p = nodes_[p].parent) {
+    path = nodes_[p].name + "/" + path;
+  }
+  return path;
+}
+
+
+void StartupProfiler::WriteJSON(const Comm_ptr_type& comm, std::ostream& os) const
+{
+  // The phases of rank 0, in depth-first order, are reduced over all ranks.
+  std::vector<int> order;
+  std::vector<int> stack(1, 0);
+  while (!stack.empty()) {
+    int n = stack.back();
+    stack.pop_back();
+    order.push_back(n);
+    stack.insert(stack.end(), nodes_[n].children.rbegin(), nodes_[n].children.rend());
+  }
+
+  std::string paths;
+  if (comm->MyPID() == 0) {
+    for (int n : order) paths += Path_(n) + "\n";
+  }
+  int npaths_chars = paths.size();
+  comm->Broadcast(&npaths_chars, 1, 0);
+  paths.resize(npaths_chars);
+  comm->Broadcast(&paths[0], npaths_chars, 0);
+
+  std::map<std::string, int> my_nodes;
+  for (int n=0; n!=(int) nodes_.size(); ++n) my_nodes[Path_(n)] = n;
+
+  // count, time, memory (max), memory (sum) of each phase
+  std::vector<std::string> path_list;
+  {
+    std::istringstream is(paths);
+    std::string path;
+    while (std::getline(is, path)) path_list.push_back(path);
+  }
+  int npaths = path_list.size();
+  std::vector<double> counts(npaths, 0.), times(npaths, 0.), memories(npaths, 0.);
+  for (int i=0; i!=npaths; ++i) {
+    auto it = my_nodes.find(path_list[i]);
+    if (it != my_nodes.end()) {
+      const Node_& node = nodes_[it->second];
+      counts[i] = node.count;
+      times[i] = node.time;
+      memories[i] = node.memory;
+    }
+  }
+  std::vector<double> stats(4*npaths, 0.);
+  std::vector<double> max_times(npaths, 0.), max_memories(npaths, 0.);
+  std::vector<double> total_counts(npaths, 0.), total_memories(npaths, 0.);
+  if (npaths > 0) {
+    comm->SumAll(counts.data(), total_counts.data(), npaths);
+    comm->MaxAll(times.data(), max_times.data(), npaths);
+    comm->MaxAll(memories.data(), max_memories.data(), npaths);
+    comm->SumAll(memories.data(), total_memories.data(), npaths);
+  }
+  if (comm->MyPID() != 0) return;
+
+  // stats indexed by rank 0 node
+  for (int i=0; i!=npaths; ++i) {
+    int n = order[i];
+    stats[4*n] = total_counts[i];
+    stats[4*n+1] = max_times[i];
+    stats[4*n+2] = max_memories[i];
+    stats[4*n+3] = total_memories[i];
+  }
+
+  os << "{" << std::endl
+     << "  \"number of processes\": " << comm->NumProc() << "," << std::endl
+     << "  \"phases\": ";
+  WriteNode_(os, 0, 2, stats);
+  os << std::endl << "}" << std::endl;
+}
+
+
+void StartupProfiler::WriteNode_(std::ostream& os, int n, int indent,
+                                 const std::vector<double>& stats) const
+{
+  const Node_& node = nodes_[n];
+  std::string pad(indent, ' ');
+  os << "{" << std::endl
+     << pad << "  \"name\": \"" << escapeJSON(node.name) << "\"," << std::endl
+     << pad << "  \"count\": " << static_cast<long>(stats[4*n]) << "," << std::endl
+     << std::setprecision(6)
+     << pad << "  \"wall time max [s]\": " << stats[4*n+1] << "," << std::endl
+     << pad << "  \"memory change max [MB]\": " << stats[4*n+2] << "," << std::endl
+     << pad << "  \"memory change total [MB]\": " << stats[4*n+3] << "," << std::endl
+     << pad << "  \"children\": [";
+  for (int i=0; i!=(int) node.children.size(); ++i) {
+    os << (i == 0 ? "" : ", ");
+    WriteNode_(os, node.children[i], indent+4, stats);
+  }
+  os << "]" << std::endl << pad << "}";
+}
+
+} // namespace Amanzi
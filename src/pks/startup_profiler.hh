@@ -0,0 +1,115 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Hierarchical wall time and memory profile of simulation startup.
+
+/*!
+
+Startup -- building regions and meshes, constructing, setting up, and
+initializing PKs, fields, and evaluators -- can take longer than the
+simulation itself on runs with large domain sets.  This records, for a tree of
+nested phases, the number of times each phase was entered, its total wall time,
+and the change in resident memory across it.
+
+Phases are opened and closed with the scoped StartupProfiler::Phase object.
+Entering a phase of the same name under the same parent accumulates into one
+entry, so per-subdomain phases (meshes or PKs on each column of a domain set)
+should be labeled with Label(), which replaces the subdomain index by "*".
+
+The profile is process-wide, as are Teuchos::TimeMonitor counters, so that
+phases may be opened anywhere (e.g. the mesh factory, the coordinator, or MPCs)
+without passing a profiler around.  It is not thread safe; startup is serial.
+
+Profiling is off unless Enable() is called, before any phase is opened.  When
+off, a Phase does nothing, so that no time or memory is sampled.
+
+WriteJSON() reduces over all processes, using the phases of rank 0.  Times are
+the max over processes, memory changes are the max and sum over processes, and
+counts are summed.
+
+*/
+
+#ifndef PKS_STARTUP_PROFILER_HH_
+#define PKS_STARTUP_PROFILER_HH_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "AmanziTypes.hh"
+
+namespace Amanzi {
+
+class StartupProfiler {
+ public:
+  // The process-wide profile.
+  static StartupProfiler& Instance();
+
+  // Opens a phase for the lifetime of this object, if profiling is enabled.
+  class Phase {
+   public:
+    explicit Phase(const std::string& name) :
+        active_(Instance().enabled()) {
+      if (active_) Instance().Start(name);
+    }
+    ~Phase() { if (active_) Instance().Stop(); }
+    Phase(const Phase& other) = delete;
+    Phase& operator=(const Phase& other) = delete;
+
+   private:
+    bool active_;
+  };
+
+  void Enable() { enabled_ = true; }
+  bool enabled() const { return enabled_; }
+
+  void Start(const std::string& name);
+  void Stop();
+
+  // Replaces the index of a domain set subdomain by "*", so that e.g.
+  // "column:12-flow" and "column:13-flow" are both "column:*-flow".
+  static std::string Label(const std::string& name);
+
+  // Memory change of this process over the phases of the subdomains of a
+  // domain set, e.g. "mesh: column:*" and "PK: column:*-flow" for the set
+  // "column".  Phases nested in one already counted are not counted again.
+  double DomainSetMemory(const std::string& ds_name) const;
+
+  // Collective.  Writes the reduced profile on rank 0.
+  void WriteJSON(const Comm_ptr_type& comm, std::ostream& os) const;
+
+  // resident memory of this process, in MBytes
+  static double ResidentMemory();
+
+ private:
+  StartupProfiler();
+
+  struct Node_ {
+    std::string name;
+    int parent;
+    std::vector<int> children;
+    int count;
+    double time;        // [s]
+    double memory;      // [MBytes]
+    double time_start;
+    double memory_start;
+  };
+
+  std::string Path_(int n) const;
+  void WriteNode_(std::ostream& os, int n, int indent,
+                  const std::vector<double>& stats) const;
+
+ private:
+  std::vector<Node_> nodes_;
+  int current_;
+  bool enabled_;
+};
+
+} // namespace Amanzi
+
+#endif
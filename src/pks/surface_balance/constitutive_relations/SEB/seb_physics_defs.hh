@@ -217,6 +217,29 @@ struct FluxBalance {
 };
 
 
+// Struct of derivatives of the ground and snow state with respect to some
+// variable, used to calculate derivatives of the balances with respect to
+// that variable.
+struct StateDerivative {
+  double ground_temp;           // [-] or [K / unit variable]
+  double ground_pressure;
+  double porosity;
+  double saturation_gas;
+  double unfrozen_fraction;
+  double snow_height;
+  double snow_density;
+
+  StateDerivative() :
+      ground_temp(0.),
+      ground_pressure(0.),
+      porosity(0.),
+      saturation_gas(0.),
+      unfrozen_fraction(0.),
+      snow_height(0.),
+      snow_density(0.) {}
+};
+
+
 // Used to calculate surface properties, prior to calling SEB.
 struct SurfaceParams {
   double a_tundra, a_water, a_ice;      // albedos
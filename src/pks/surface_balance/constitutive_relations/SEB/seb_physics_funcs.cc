@@ -17,6 +17,8 @@ namespace SEBPhysics {
 
 #define SWE_EPS 1.e-12
 #define ENERGY_BALANCE_TOL 1.e-8
+#define SNOW_TEMP_NEWTON_MAX_IT 20
+#define SNOW_TEMP_NEWTON_MAX_STEP 10.
 
 
 double CalcAlbedoSnow(double density_snow) {
@@ -88,6 +90,19 @@ double StabilityFunction(double air_temp, double skin_temp, double Us,
 }
 
 
+double StabilityFunctionDerivative(double air_temp, double skin_temp, double Us,
+                                   double Z_Us, double c_gravity)
+{
+  double dRi = -c_gravity * Z_Us / (air_temp * std::pow(Us,2));
+  double Ri = dRi * (skin_temp - air_temp);
+  if (Ri >= 0.) {
+    return -10 * dRi / std::pow(1 + 10*Ri, 2);
+  } else {
+    return -10 * dRi;
+  }
+}
+
+
 double SaturatedVaporPressure(double temp)
 {
   // Sat vap. press o/water Dingman D-7 (Bolton, 1980)
@@ -96,6 +111,12 @@ double SaturatedVaporPressure(double temp)
   return 0.6112 * std::exp(17.67 * tempC / (tempC + 243.5));
 }
 
+double SaturatedVaporPressureDerivative(double temp)
+{
+  double tempC = temp - 273.15;
+  return SaturatedVaporPressure(temp) * 17.67 * 243.5 / std::pow(tempC + 243.5, 2);
+}
+
 double VaporPressureAir(double air_temp, double relative_humidity)
 {
   return SaturatedVaporPressure(air_temp) * relative_humidity;
@@ -169,16 +190,32 @@ double LatentHeat(double resistance_coef,
       * (vapor_pressure_air - vapor_pressure_skin) / Apa;
 }
 
-double ConductedHeatIfSnow(double ground_temp,
-                           const SnowProperties& snow, const ModelParams& params)
+double ThermalConductivitySnow(const SnowProperties& snow, const ModelParams& params)
 {
-  // Calculate heat conducted to ground, if snow
   double density = snow.density;
   if (density > 150) {
     // adjust for frost hoar
     density = 1. / ((0.90/density) + (0.10/150));
   }
-  double Ks = params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+  return params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+}
+
+double ThermalConductivitySnowDerivative(const SnowProperties& snow, const ModelParams& params)
+{
+  double density = snow.density;
+  double ddensity = 1.;
+  if (density > 150) {
+    density = 1. / ((0.90/snow.density) + (0.10/150));
+    ddensity = std::pow(density / snow.density, 2) * 0.90;
+  }
+  return params.thermalK_snow_exp * ThermalConductivitySnow(snow, params) / density * ddensity;
+}
+
+double ConductedHeatIfSnow(double ground_temp,
+                           const SnowProperties& snow, const ModelParams& params)
+{
+  // Calculate heat conducted to ground, if snow
+  double Ks = ThermalConductivitySnow(snow, params);
   return Ks * (snow.temp - ground_temp) / snow.height;
 }
 
@@ -212,6 +249,64 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
   eb.fQm = eb.fQswIn + eb.fQlwIn - eb.fQlwOut + eb.fQh - eb.fQc + eb.fQe;
 }
 
+EnergyBalance UpdateEnergyBalanceWithSnow_InnerDerivative(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params,
+        const StateDerivative& dstate,
+        double dsnow_temp)
+{
+  EnergyBalance deb;
+  deb.fQswIn = 0.;
+  deb.fQlwIn = 0.;
+
+  // outgoing radiation
+  deb.fQlwOut = 4 * snow.emissivity * params.stephB * std::pow(snow.temp,3) * dsnow_temp;
+
+  // wind factor depends upon snow height through the roughness
+  double Z_rough = CalcRoughnessFactor(snow.height, surf.roughness, snow.roughness);
+  double dZ_rough = (snow.height > 0. && snow.height < surf.roughness) ?
+                    (snow.roughness - surf.roughness) / surf.roughness * dstate.snow_height : 0.;
+  double Dhe = WindFactor(met.Us, met.Z_Us, Z_rough, params.VKc);
+  double dDhe = 2 * Dhe / (Z_rough * std::log(met.Z_Us / Z_rough)) * dZ_rough;
+
+  double Sqig = StabilityFunction(met.air_temp, snow.temp, met.Us, met.Z_Us, params.gravity);
+  double dSqig = StabilityFunctionDerivative(met.air_temp, snow.temp, met.Us, met.Z_Us, params.gravity)
+                 * dsnow_temp;
+  double dcoef = dDhe * Sqig + Dhe * dSqig;
+
+  // sensible heat
+  deb.fQh = params.density_air * params.Cp_air
+            * (dcoef * (met.air_temp - snow.temp) - Dhe * Sqig * dsnow_temp);
+
+  // latent heat
+  double vapor_pressure_air = VaporPressureAir(met.air_temp, met.relative_humidity);
+  double vapor_pressure_skin = SaturatedVaporPressure(snow.temp);
+  double dvapor_pressure_skin = SaturatedVaporPressureDerivative(snow.temp) * dsnow_temp;
+  deb.fQe = params.density_air * params.Ls * 0.622 / params.Apa
+            * (dcoef * (vapor_pressure_air - vapor_pressure_skin) - Dhe * Sqig * dvapor_pressure_skin);
+
+  // conducted heat
+  double Ks = ThermalConductivitySnow(snow, params);
+  double dKs = ThermalConductivitySnowDerivative(snow, params) * dstate.snow_density;
+  deb.fQc = (dKs * (snow.temp - surf.temp) + Ks * (dsnow_temp - dstate.ground_temp)) / snow.height
+            - Ks * (snow.temp - surf.temp) / std::pow(snow.height, 2) * dstate.snow_height;
+
+  deb.fQm = - deb.fQlwOut + deb.fQh - deb.fQc + deb.fQe;
+  deb.error = 0.;
+  return deb;
+}
+
+double UpdateEnergyBalanceWithSnow_InnerDerivative(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params)
+{
+  return UpdateEnergyBalanceWithSnow_InnerDerivative(surf, snow, met, params,
+          StateDerivative(), 1.).fQm;
+}
+
+
 EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params,
@@ -297,15 +392,38 @@ double DetermineSnowTemperature(const GroundProperties& surf,
   SnowTemperatureFunctor_ func(&surf, &snow, &met, &params, &eb);
   Tol_ tol(ENERGY_BALANCE_TOL);
   boost::uintmax_t max_it(100);
+
+  // warm start from the provided snow temperature, if any
+  double guess = std::isfinite(snow.temp) ? snow.temp : surf.temp;
+
+  if (method == "newton") {
+    // The residual decreases monotonically in snow temperature, so Newton's
+    // method, with steps limited to avoid overshooting into unphysical
+    // temperatures, converges from any reasonable guess.  If it does not, fall
+    // back to bracketing.
+    double temp = guess;
+    for (int it=0; it!=SNOW_TEMP_NEWTON_MAX_IT; ++it) {
+      double res = func(temp);
+      double dres = UpdateEnergyBalanceWithSnow_InnerDerivative(surf, snow, met, params);
+      if (!(dres < 0.) || !std::isfinite(res)) break;
+
+      double dtemp = std::max(-SNOW_TEMP_NEWTON_MAX_STEP,
+                              std::min(SNOW_TEMP_NEWTON_MAX_STEP, -res / dres));
+      temp += dtemp;
+      if (std::abs(dtemp) <= ENERGY_BALANCE_TOL) return temp;
+    }
+    method = "toms";
+  }
+
   double left, right;
   double res_left, res_right;
 
-  double res_init = func(surf.temp);
+  double res_init = func(guess);
   if (res_init < 0.) {
-    right = surf.temp;
+    right = guess;
     res_right = res_init;
 
-    left = surf.temp - 1.;
+    left = guess - 1.;
     res_left = func(left);
     while (res_left < 0.) {
       right = left;
@@ -314,10 +432,10 @@ double DetermineSnowTemperature(const GroundProperties& surf,
       res_left = func(left);
     }
   } else {
-    left = surf.temp;
+    left = guess;
     res_left = res_init;
 
-    right = surf.temp + 1.;
+    right = guess + 1.;
     res_right = func(right);
     while (res_right > 0.) {
       left = right;
@@ -441,6 +559,162 @@ FluxBalance UpdateFluxesWithSnow(const GroundProperties& surf,
 }
 
 
+EnergyBalance UpdateEnergyBalanceWithSnowDerivative(const GroundProperties& surf,
+        const MetData& met,
+        const ModelParams& params,
+        const SnowProperties& snow,
+        const StateDerivative& dstate)
+{
+  // derivative at fixed snow temperature
+  EnergyBalance deb = UpdateEnergyBalanceWithSnow_InnerDerivative(surf, snow, met, params, dstate, 0.);
+
+  if (snow.temp < 273.15) {
+    // The snow temperature adjusts to keep the balance at zero, so by the
+    // implicit function theorem, dT_snow = - dR / (dR/dT_snow).
+    double dsnow_temp = -deb.fQm / UpdateEnergyBalanceWithSnow_InnerDerivative(surf, snow, met, params);
+    deb = UpdateEnergyBalanceWithSnow_InnerDerivative(surf, snow, met, params, dstate, dsnow_temp);
+    deb.fQm = 0.;
+  }
+  return deb;
+}
+
+
+EnergyBalance UpdateEnergyBalanceWithoutSnowDerivative(const GroundProperties& surf,
+        const MetData& met,
+        const ModelParams& params,
+        const StateDerivative& dstate)
+{
+  EnergyBalance deb;
+  deb.fQswIn = 0.;
+  deb.fQlwIn = 0.;
+
+  // outgoing radiation
+  deb.fQlwOut = 4 * surf.emissivity * params.stephB * std::pow(surf.temp,3) * dstate.ground_temp;
+
+  // precip melting
+  if (surf.temp > 273.65 || surf.temp <= 273.15) {
+    deb.fQm = 0.;
+  } else {
+    double Em = (met.Ps + surf.snow_death_rate) * surf.density_w * params.Hf;
+    deb.fQm = Em / 0.5 * dstate.ground_temp;
+  }
+
+  // sensible heat
+  double Dhe = WindFactor(met.Us, met.Z_Us, surf.roughness, params.VKc);
+  double Sqig = StabilityFunction(met.air_temp, surf.temp, met.Us, met.Z_Us, params.gravity);
+  double dSqig = StabilityFunctionDerivative(met.air_temp, surf.temp, met.Us, met.Z_Us, params.gravity)
+                 * dstate.ground_temp;
+  deb.fQh = Dhe * params.density_air * params.Cp_air
+            * (dSqig * (met.air_temp - surf.temp) - Sqig * dstate.ground_temp);
+
+  // latent heat
+  double vapor_pressure_air = VaporPressureAir(met.air_temp, met.relative_humidity);
+  double vapor_pressure_skin = VaporPressureGround(surf, params);
+  double dvapor_pressure_skin = 0.;
+  if (surf.pressure < params.Apa * 1000.) {
+    // vapor pressure lowering, d(rh * e_sat)
+    double pc = 1000.*params.Apa - surf.pressure;
+    double RT = surf.density_w * params.R_ideal_gas * surf.temp;
+    double rh = std::exp(-pc / RT);
+    double drh = rh * (dstate.ground_pressure / RT + pc / (RT * surf.temp) * dstate.ground_temp);
+    dvapor_pressure_skin = drh * SaturatedVaporPressure(surf.temp)
+                           + rh * SaturatedVaporPressureDerivative(surf.temp) * dstate.ground_temp;
+  } else {
+    dvapor_pressure_skin = SaturatedVaporPressureDerivative(surf.temp) * dstate.ground_temp;
+  }
+
+  double Rsoil = EvaporativeResistanceGround(surf, met, params, vapor_pressure_air, vapor_pressure_skin);
+  double dRsoil = 0.;
+  if (Rsoil > 0.) {
+    double a = 0.0556 / surf.porosity;
+    double m = 2 + 3*params.Clapp_Horn_b;
+    double vp_diffusion = 0.000022 * std::pow(surf.porosity,2) * std::pow(1-a, m);
+    double dvp_diffusion = 0.000022 * (2*surf.porosity * std::pow(1-a, m)
+            + m * std::pow(1-a, m-1) * 0.0556) * dstate.porosity;
+    double L_Rsoil = surf.dz * (std::exp(std::pow(surf.saturation_gas, 5)) - 1) / (std::exp(1.) - 1);
+    double dL_Rsoil = surf.dz * std::exp(std::pow(surf.saturation_gas, 5))
+                      * 5 * std::pow(surf.saturation_gas, 4) / (std::exp(1.) - 1) * dstate.saturation_gas;
+    dRsoil = dL_Rsoil / vp_diffusion - L_Rsoil * dvp_diffusion / std::pow(vp_diffusion, 2);
+  }
+  double coef = 1.0 / (Rsoil + 1.0/(Dhe*Sqig));
+  double dcoef = -coef * coef * (dRsoil - dSqig / (Dhe * Sqig * Sqig));
+
+  double L = surf.unfrozen_fraction * params.Le + (1-surf.unfrozen_fraction) * params.Ls;
+  double dL = (params.Le - params.Ls) * dstate.unfrozen_fraction;
+  deb.fQe = params.density_air * 0.622 / params.Apa
+            * ((dcoef * L + coef * dL) * (vapor_pressure_air - vapor_pressure_skin)
+               - coef * L * dvapor_pressure_skin);
+
+  deb.fQc = 0.;
+  deb.error = 0.;
+  return deb;
+}
+
+
+MassBalance UpdateMassBalanceWithSnowDerivative(const GroundProperties& surf,
+        const ModelParams& params, const EnergyBalance& deb)
+{
+  MassBalance dmb;
+  dmb.Mm = deb.fQm / (surf.density_w * params.Hf);
+  dmb.Me = deb.fQe / (surf.density_w * params.Ls);
+  return dmb;
+}
+
+
+MassBalance UpdateMassBalanceWithoutSnowDerivative(const GroundProperties& surf,
+        const ModelParams& params, const EnergyBalance& eb,
+        const StateDerivative& dstate, const EnergyBalance& deb)
+{
+  MassBalance dmb;
+  dmb.Mm = deb.fQm / (surf.density_w * params.Hf);
+  double L = surf.unfrozen_fraction * params.Le + (1-surf.unfrozen_fraction) * params.Ls;
+  double dL = (params.Le - params.Ls) * dstate.unfrozen_fraction;
+  dmb.Me = deb.fQe / (surf.density_w * L) - eb.fQe * dL / (surf.density_w * L * L);
+  return dmb;
+}
+
+
+FluxBalance UpdateFluxesWithSnowDerivative(const EnergyBalance& deb,
+        const MassBalance& dmb)
+{
+  FluxBalance dflux;
+  dflux.M_surf = dmb.Mm;
+  dflux.M_snow = dmb.Me - dmb.Mm;
+  dflux.E_surf = deb.fQc;
+  return dflux;
+}
+
+
+FluxBalance UpdateFluxesWithoutSnowDerivative(const GroundProperties& surf,
+        const MetData& met, const ModelParams& params, const MassBalance& mb,
+        const StateDerivative& dstate, const EnergyBalance& deb, const MassBalance& dmb)
+{
+  FluxBalance dflux;
+  dflux.M_surf = dmb.Mm;
+  dflux.E_surf = - deb.fQlwOut + deb.fQh - deb.fQm + deb.fQe;
+
+  // evaporation is split between surface and subsurface as a function of
+  // pressure, see UpdateFluxesWithoutSnow()
+  double evap_to_subsurface_fraction = 0.;
+  double devap_to_subsurface_fraction = 0.;
+  if (mb.Me < 0) {
+    if (surf.pressure >= 1000.*params.Apa + params.evap_transition_width) {
+      evap_to_subsurface_fraction = 0.;
+    } else if (surf.pressure < 1000.*params.Apa) {
+      evap_to_subsurface_fraction = 1.;
+    } else {
+      evap_to_subsurface_fraction = (1000.*params.Apa + params.evap_transition_width - surf.pressure) / (params.evap_transition_width);
+      devap_to_subsurface_fraction = -dstate.ground_pressure / params.evap_transition_width;
+    }
+  }
+  dflux.M_surf += (1. - evap_to_subsurface_fraction) * dmb.Me - devap_to_subsurface_fraction * mb.Me;
+  dflux.M_subsurf = evap_to_subsurface_fraction * dmb.Me + devap_to_subsurface_fraction * mb.Me;
+
+  dflux.M_snow = -dmb.Mm;
+  return dflux;
+}
+
+
 
 
 
@@ -115,6 +115,21 @@ double LatentHeat(double resistance_coef,
 double ConductedHeatIfSnow(double ground_temp,
                            const SnowProperties& snow);
 
+// 
+// Thermal conductivity of snow as a function of its density.
+// ------------------------------------------------------------------------------------------
+double ThermalConductivitySnow(const SnowProperties& snow, const ModelParams& params);
+
+// 
+// Derivatives of the stability function and saturated vapor pressure with
+// respect to skin temperature, and of the thermal conductivity of snow with
+// respect to its density.
+// ------------------------------------------------------------------------------------------
+double StabilityFunctionDerivative(double air_temp, double skin_temp, double Us,
+                                   double Z_Us, double c_gravity);
+double SaturatedVaporPressureDerivative(double temp);
+double ThermalConductivitySnowDerivative(const SnowProperties& snow, const ModelParams& params);
+
 // 
 // Update the energy balance, solving for the amount of heat available to melt snow.
 //
@@ -127,17 +142,44 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
         const ModelParams& params,
         EnergyBalance& eb);
 
+// 
+// Derivative of the energy balance computed by UpdateEnergyBalanceWithSnow_Inner(),
+// given derivatives of the state and of the snow temperature with respect to
+// some variable.
+// ------------------------------------------------------------------------------------------
+EnergyBalance UpdateEnergyBalanceWithSnow_InnerDerivative(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params,
+        const StateDerivative& dstate,
+        double dsnow_temp);
+
+// 
+// Derivative of the energy available for melt, eb.fQm as computed by
+// UpdateEnergyBalanceWithSnow_Inner(), with respect to snow temperature.
+// ------------------------------------------------------------------------------------------
+double UpdateEnergyBalanceWithSnow_InnerDerivative(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params);
+
 // 
 // Determine the snow temperature by solving for energy balance, i.e. the snow
 // temp at equilibrium.  Assumes no melting (and therefore T_snow calculated
 // can be greater than 0 C.
+//
+// If snow.temp is set on input, it is used as the initial guess (e.g. the
+// solution from the previous evaluation), otherwise the ground temperature is
+// used.  Method is one of "newton", which uses the analytic derivative and
+// falls back to "toms" if it fails to converge, "toms", or "bisection".  The
+// latter two bracket the root by stepping 1 K at a time from the guess.
 // ------------------------------------------------------------------------------------------
 double DetermineSnowTemperature(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params,
         SnowProperties& snow,
         EnergyBalance& eb,
-        std::string method="toms");
+        std::string method="newton");
 
 
 // 
@@ -191,6 +233,39 @@ FluxBalance UpdateFluxesWithoutSnow(const GroundProperties& surf,
         const MassBalance& mb);
 
 
+// 
+// Derivatives of the above balances with respect to some variable, given the
+// derivatives of the state with respect to that variable.  Each takes the
+// same inputs as the balance it differentiates, after that balance has been
+// computed (so that, with snow, snow.temp is the solved snow temperature),
+// along with the derivatives of the balances it depends upon.  Derivatives of
+// all terms are returned in the corresponding balance struct.
+// ------------------------------------------------------------------------------------------
+EnergyBalance UpdateEnergyBalanceWithSnowDerivative(const GroundProperties& surf,
+        const MetData& met,
+        const ModelParams& params,
+        const SnowProperties& snow,
+        const StateDerivative& dstate);
+
+EnergyBalance UpdateEnergyBalanceWithoutSnowDerivative(const GroundProperties& surf,
+        const MetData& met,
+        const ModelParams& params,
+        const StateDerivative& dstate);
+
+MassBalance UpdateMassBalanceWithSnowDerivative(const GroundProperties& surf,
+        const ModelParams& params, const EnergyBalance& deb);
+
+MassBalance UpdateMassBalanceWithoutSnowDerivative(const GroundProperties& surf,
+        const ModelParams& params, const EnergyBalance& eb,
+        const StateDerivative& dstate, const EnergyBalance& deb);
+
+FluxBalance UpdateFluxesWithSnowDerivative(const EnergyBalance& deb,
+        const MassBalance& dmb);
+
+FluxBalance UpdateFluxesWithoutSnowDerivative(const GroundProperties& surf,
+        const MetData& met, const ModelParams& params, const MassBalance& mb,
+        const StateDerivative& dstate, const EnergyBalance& deb, const MassBalance& dmb);
+
 
 // Calculation of a snow temperature requires a root-finding operation, for
 // which we use a functor.
@@ -25,6 +25,7 @@ respectively.
 
 */
 
+#include <limits>
 #include "boost/algorithm/string/predicate.hpp"
 
 #include "VerboseObject.hh"
@@ -164,38 +165,123 @@ SubgridEvaluator::SubgridEvaluator(Teuchos::ParameterList& plist) :
   roughness_snow_covered_ground_ = plist.get<double>("roughness length of snow-covered ground [m]", 0.004);
 }
 
+SubgridEvaluator::Inputs_
+SubgridEvaluator::GetInputs_(const Teuchos::Ptr<State>& S) const
+{
+  return Inputs_{
+    // met data
+    *S->GetFieldData(met_sw_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(met_lw_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(met_air_temp_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(met_rel_hum_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(met_wind_speed_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(met_prain_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(met_psnow_key_)->ViewComponent("cell",false),
+
+    // snow properties
+    *S->GetFieldData(snow_depth_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(snow_dens_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(snow_death_rate_key_)->ViewComponent("cell",false),
+
+    // skin properties
+    *S->GetFieldData(unfrozen_fraction_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(sg_albedo_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(sg_emissivity_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(area_frac_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(surf_pres_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(surf_temp_key_)->ViewComponent("cell",false),
+
+    // subsurface properties
+    *S->GetFieldData(sat_gas_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(poro_key_)->ViewComponent("cell",false),
+    *S->GetFieldData(ss_pres_key_)->ViewComponent("cell",false),
+
+    *S->GetMesh(domain_),
+    *S->GetMesh(domain_ss_)
+  };
+}
+
+
+AmanziMesh::Entity_ID
+SubgridEvaluator::SetupCell_(const Inputs_& in, const SEBPhysics::ModelParams& params, int c,
+                             SEBPhysics::MetData (&met)[3], SEBPhysics::GroundProperties (&surf)[3],
+                             SEBPhysics::SnowProperties& snow) const
+{
+  // get the top cell
+  AmanziMesh::Entity_ID subsurf_f = in.mesh.entity_get_parent(AmanziMesh::CELL, c);
+  AmanziMesh::Entity_ID_List cells;
+  in.mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
+  AMANZI_ASSERT(cells.size() == 1);
+
+  // met data structure
+  met[0].Z_Us = wind_speed_ref_ht_;
+  met[0].Us = std::max(in.wind_speed[0][c], min_wind_speed_);
+  met[0].QswIn = in.qSW_in[0][c];
+  met[0].QlwIn = in.qLW_in[0][c];
+  met[0].air_temp = in.air_temp[0][c];
+  met[0].relative_humidity = std::max(in.rel_hum[0][c], min_rel_hum_);
+  met[0].Pr = in.Prain[0][c];
+
+  for (int patch=0; patch!=3; ++patch) {
+    surf[patch].temp = in.surf_temp[0][c];
+    surf[patch].pressure = in.surf_pres[0][c];
+    if (ss_topcell_based_evap_)
+      surf[patch].pressure = in.ss_pres[0][cells[0]];
+    surf[patch].roughness = roughness_bare_ground_;
+    surf[patch].density_w = params.density_water; // NOTE: could update this to use true density! --etc
+    surf[patch].dz = dessicated_zone_thickness_;
+    surf[patch].albedo = in.sg_albedo[patch][c];
+    surf[patch].emissivity = in.emissivity[patch][c];
+    surf[patch].porosity = 1.;
+    surf[patch].saturation_gas = 0.;
+    surf[patch].unfrozen_fraction = in.unfrozen_fraction[0][c];
+  }
+
+  // bare ground column
+  if (!ss_topcell_based_evap_)
+    surf[0].pressure = std::min<double>(in.surf_pres[0][c], 101325.);
+  surf[0].porosity = in.poro[0][cells[0]];
+  surf[0].saturation_gas = in.sat_gas[0][cells[0]];
+
+  // must ensure that energy is put into melting snow precip, even if it
+  // all melts so there is no snow column
+  if (in.area_fracs[2][c] == 0.) {
+    met[0].Ps = in.Psnow[0][c];
+    surf[0].snow_death_rate = in.snow_death_rate[0][c]; // m H20 / s
+  } else {
+    met[0].Ps = 0.;
+    surf[0].snow_death_rate = 0.;
+  }
+
+  // water column
+  met[1] = met[0];
+  surf[1].snow_death_rate = surf[0].snow_death_rate;
+
+  // snow column
+  met[2] = met[0];
+  if (in.area_fracs[2][c] > 0.) {
+    met[2].Ps = in.Psnow[0][c] / in.area_fracs[2][c];
+
+    // take the snow height to be some measure of average thickness -- use
+    // volumetric snow depth divided by the area fraction of snow
+    snow.height = in.snow_volumetric_depth[0][c] / in.area_fracs[2][c];
+    snow.density = in.snow_dens[0][c];
+    snow.albedo = surf[2].albedo;
+    snow.emissivity = surf[2].emissivity;
+    snow.roughness = roughness_snow_covered_ground_;
+    snow.temp = snow_temp_guess_[c]; // warm start from the last solve
+  }
+  return cells[0];
+}
+
+
 void
 SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
                              const std::vector<Teuchos::Ptr<CompositeVector> >& results)
 {
   const SEBPhysics::ModelParams params;
-
-  // collect met data
-  const auto& qSW_in = *S->GetFieldData(met_sw_key_)->ViewComponent("cell",false);
-  const auto& qLW_in = *S->GetFieldData(met_lw_key_)->ViewComponent("cell",false);
-  const auto& air_temp = *S->GetFieldData(met_air_temp_key_)->ViewComponent("cell",false);
-  const auto& rel_hum = *S->GetFieldData(met_rel_hum_key_)->ViewComponent("cell",false);
-  const auto& wind_speed = *S->GetFieldData(met_wind_speed_key_)->ViewComponent("cell",false);
-  const auto& Prain = *S->GetFieldData(met_prain_key_)->ViewComponent("cell",false);
-  const auto& Psnow = *S->GetFieldData(met_psnow_key_)->ViewComponent("cell",false);
-
-  // collect snow properties
-  const auto& snow_volumetric_depth = *S->GetFieldData(snow_depth_key_)->ViewComponent("cell",false);
-  const auto& snow_dens = *S->GetFieldData(snow_dens_key_)->ViewComponent("cell",false);
-  const auto& snow_death_rate = *S->GetFieldData(snow_death_rate_key_)->ViewComponent("cell",false);
-
-  // collect skin properties
-  const auto& unfrozen_fraction = *S->GetFieldData(unfrozen_fraction_key_)->ViewComponent("cell",false);
-  const auto& sg_albedo = *S->GetFieldData(sg_albedo_key_)->ViewComponent("cell",false);
-  const auto& emissivity = *S->GetFieldData(sg_emissivity_key_)->ViewComponent("cell",false);
-  const auto& area_fracs = *S->GetFieldData(area_frac_key_)->ViewComponent("cell",false);
-  const auto& surf_pres = *S->GetFieldData(surf_pres_key_)->ViewComponent("cell",false);
-  const auto& surf_temp = *S->GetFieldData(surf_temp_key_)->ViewComponent("cell",false);
-
-  // collect subsurface properties
-  const auto& sat_gas = *S->GetFieldData(sat_gas_key_)->ViewComponent("cell",false);
-  const auto& poro = *S->GetFieldData(poro_key_)->ViewComponent("cell",false);
-  const auto& ss_pres = *S->GetFieldData(ss_pres_key_)->ViewComponent("cell",false);
+  const Inputs_ in = GetInputs_(S);
+  const auto& area_fracs = in.area_fracs;
 
   // collect output vecs
   auto& mass_source = *results[0]->ViewComponent("cell",false);
@@ -211,9 +297,6 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   snow_source.PutScalar(0.);
   new_snow.PutScalar(0.);
 
-  const auto& mesh = *S->GetMesh(domain_);
-  const auto& mesh_ss = *S->GetMesh(domain_ss_);
-
   Epetra_MultiVector *melt_rate(nullptr), *evap_rate(nullptr), *snow_temp(nullptr);
   Epetra_MultiVector *qE_sh(nullptr), *qE_lh(nullptr), *qE_sm(nullptr);
   Epetra_MultiVector *qE_lw_out(nullptr), *qE_cond(nullptr), *albedo(nullptr);
@@ -239,154 +322,58 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   }
 
   unsigned int ncells = mass_source.MyLength();
+  if (snow_temp_guess_.size() != ncells)
+    snow_temp_guess_.assign(ncells, std::numeric_limits<double>::quiet_NaN());
+  balances_.resize(ncells);
   for (unsigned int c=0; c!=ncells; ++c) {
-    // get the top cell
-    AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
-    AmanziMesh::Entity_ID_List cells;
-    mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-
-    // met data structure
-    SEBPhysics::MetData met;
-    met.Z_Us = wind_speed_ref_ht_;
-    met.Us = std::max(wind_speed[0][c], min_wind_speed_);
-    met.QswIn = qSW_in[0][c];
-    met.QlwIn = qLW_in[0][c];
-    met.air_temp = air_temp[0][c];
-    met.relative_humidity = std::max(rel_hum[0][c], min_rel_hum_);
-    met.Pr = Prain[0][c];
-
-    // bare ground column
-    if (area_fracs[0][c] > 0.) {
-      SEBPhysics::GroundProperties surf;
-      surf.temp = surf_temp[0][c];
-      surf.pressure = std::min<double>(surf_pres[0][c], 101325.);
-      if (ss_topcell_based_evap_)
-        surf.pressure = ss_pres[0][cells[0]];
-      surf.roughness = roughness_bare_ground_;
-      surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
-      surf.dz = dessicated_zone_thickness_;
-      surf.albedo = sg_albedo[0][c];
-      surf.emissivity = emissivity[0][c];
-
-      surf.porosity = poro[0][cells[0]];
-      surf.saturation_gas = sat_gas[0][cells[0]];
-      surf.unfrozen_fraction = unfrozen_fraction[0][c];
-
-      // must ensure that energy is put into melting snow precip, even if it
-      // all melts so there is no snow column
-      if (area_fracs[2][c] == 0.) {
-        met.Ps = Psnow[0][c];
-        surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
-      } else {
-        met.Ps = 0.;
-        surf.snow_death_rate = 0.;
-      }
-
-      // calculate the surface balance
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf, met, params);
-      SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithoutSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
+    SEBPhysics::MetData met[3];
+    SEBPhysics::GroundProperties surf[3];
+    SEBPhysics::SnowProperties snow;
+    AmanziMesh::Entity_ID top_cell = SetupCell_(in, params, c, met, surf, snow);
+    CellBalances_& bal = balances_[c];
 
-      // fQe, Me positive is condensation, water flux positive to surface
-      mass_source[0][c] += area_fracs[0][c] * flux.M_surf;
-      energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
-
-      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-      double ss_mass_source_l = flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
-      ss_mass_source[0][cells[0]] += area_fracs[0][c] * ss_mass_source_l;
-      double ss_energy_source_l = flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-      ss_energy_source[0][cells[0]] += area_fracs[0][c] * ss_energy_source_l;
-
-      snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
-      new_snow[0][c] += area_fracs[0][c] * met.Ps;
-
-      if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "CELL " << c << " BARE"
-                    << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
-                    << ", Mss = " << ss_mass_source_l << ", Ess = " << ss_energy_source_l
-                    << ", Sn = " << flux.M_snow << std::endl;
-
-      // diagnostics
-      if (diagnostics_) {
-        (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
-        (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
-        (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
-        (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
-        (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
-        (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
-
-        if (area_fracs[2][c] == 0.) {
-          (*qE_sm)[0][c] += area_fracs[0][c] * eb.fQm;
-          (*melt_rate)[0][c] += area_fracs[0][c] * mb.Mm;
-          (*snow_temp)[0][c] = 273.15;
-        }
-      }
-    }
-
-    // water column
-    if (area_fracs[1][c] > 0.) {
-      SEBPhysics::GroundProperties surf;
-      surf.temp = surf_temp[0][c];
-      surf.pressure = surf_pres[0][c];
-      if (ss_topcell_based_evap_)
-        surf.pressure = ss_pres[0][cells[0]];
-      surf.roughness = roughness_bare_ground_;
-      surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
-      surf.dz = dessicated_zone_thickness_;
-      surf.emissivity = emissivity[1][c];
-      surf.albedo = sg_albedo[1][c];
-
-      surf.porosity = 1.;
-      surf.saturation_gas = 0.;
-      surf.unfrozen_fraction = unfrozen_fraction[0][c];
-
-      // must ensure that energy is put into melting snow precip, even if it
-      // all melts so there is no snow column
-      if (area_fracs[2][c] == 0.) {
-        met.Ps = Psnow[0][c];
-        surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
-      } else {
-        met.Ps = 0.;
-        surf.snow_death_rate = 0.;
-      }
+    // bare ground (0) and water (1) columns
+    for (int patch=0; patch!=2; ++patch) {
+      if (area_fracs[patch][c] <= 0.) continue;
 
       // calculate the surface balance
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf, met, params);
-      const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithoutSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
+      bal.eb[patch] = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf[patch], met[patch], params);
+      bal.mb[patch] = SEBPhysics::UpdateMassBalanceWithoutSnow(surf[patch], params, bal.eb[patch]);
+      const SEBPhysics::EnergyBalance& eb = bal.eb[patch];
+      const SEBPhysics::MassBalance& mb = bal.mb[patch];
+      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf[patch], met[patch], params, eb, mb);
 
       // fQe, Me positive is condensation, water flux positive to surface
-      mass_source[0][c] += area_fracs[1][c] * flux.M_surf;
-      energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6;
+      mass_source[0][c] += area_fracs[patch][c] * flux.M_surf;
+      energy_source[0][c] += area_fracs[patch][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
 
-      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
+      double area_to_volume = in.mesh.cell_volume(c) / in.mesh_ss.cell_volume(top_cell);
       double ss_mass_source_l = flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
-      ss_mass_source[0][cells[0]] += area_fracs[1][c] * ss_mass_source_l;
+      ss_mass_source[0][top_cell] += area_fracs[patch][c] * ss_mass_source_l;
       double ss_energy_source_l = flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-      ss_energy_source[0][cells[0]] += area_fracs[1][c] * ss_energy_source_l;
+      ss_energy_source[0][top_cell] += area_fracs[patch][c] * ss_energy_source_l;
 
-      snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
-      new_snow[0][c] += area_fracs[1][c] * met.Ps;
+      snow_source[0][c] += area_fracs[patch][c] * flux.M_snow;
+      new_snow[0][c] += area_fracs[patch][c] * met[patch].Ps;
 
       if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "CELL " << c << " WATER"
+        *vo_->os() << "CELL " << c << (patch == 0 ? " BARE" : " WATER")
                     << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
                     << ", Mss = " << ss_mass_source_l << ", Ess = " << ss_energy_source_l
                     << ", Sn = " << flux.M_snow << std::endl;
 
       // diagnostics
       if (diagnostics_) {
-        (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
-        (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
-        (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
-        (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
-        (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
-        (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
+        (*evap_rate)[0][c] -= area_fracs[patch][c] * mb.Me;
+        (*qE_sh)[0][c] += area_fracs[patch][c] * eb.fQh;
+        (*qE_lh)[0][c] += area_fracs[patch][c] * eb.fQe;
+        (*qE_lw_out)[0][c] += area_fracs[patch][c] * eb.fQlwOut;
+        (*qE_cond)[0][c] += area_fracs[patch][c] * eb.fQc;
+        (*albedo)[0][c] += area_fracs[patch][c] * surf[patch].albedo;
 
         if (area_fracs[2][c] == 0.) {
-          (*qE_sm)[0][c] += area_fracs[1][c] * eb.fQm;
-          (*melt_rate)[0][c] += area_fracs[1][c] * mb.Mm;
+          (*qE_sm)[0][c] += area_fracs[patch][c] * eb.fQm;
+          (*melt_rate)[0][c] += area_fracs[patch][c] * mb.Mm;
           (*snow_temp)[0][c] = 273.15;
         }
       }
@@ -394,45 +381,18 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 
     // snow column
     if (area_fracs[2][c] > 0.) {
-      SEBPhysics::GroundProperties surf;
-      surf.temp = surf_temp[0][c];
-      surf.pressure = surf_pres[0][c];
-      if (ss_topcell_based_evap_) surf.pressure = ss_pres[0][cells[0]];
-      surf.roughness = roughness_bare_ground_;
-      surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
-      surf.dz = dessicated_zone_thickness_;
-      surf.emissivity = emissivity[2][c];
-      surf.albedo = sg_albedo[2][c];
-
-      surf.saturation_gas = 0.;
-      surf.porosity = 1.;
-      surf.unfrozen_fraction = unfrozen_fraction[0][c];
-
-      met.Ps = Psnow[0][c] / area_fracs[2][c];
-
-      SEBPhysics::SnowProperties snow;
-      // take the snow height to be some measure of average thickness -- use
-      // volumetric snow depth divided by the area fraction of snow
-      snow.height = snow_volumetric_depth[0][c] / area_fracs[2][c];
-
-      // area_fracs may have been set to 1 for snow depth < snow_ground_trans
-      // due to min fractional area option in area_fractions evaluator.
-      // Decreasing the tol by 1e-6 is about equivalent to a min fractional
-      // area of 1e-5 (the default)
-      snow.density = snow_dens[0][c];
-      snow.albedo = surf.albedo;
-      snow.emissivity = surf.emissivity;
-      snow.roughness = roughness_snow_covered_ground_;
-
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
-      const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
+      bal.eb[2] = SEBPhysics::UpdateEnergyBalanceWithSnow(surf[2], met[2], params, snow);
+      snow_temp_guess_[c] = snow.temp;
+      bal.mb[2] = SEBPhysics::UpdateMassBalanceWithSnow(surf[2], params, bal.eb[2]);
+      const SEBPhysics::EnergyBalance& eb = bal.eb[2];
+      const SEBPhysics::MassBalance& mb = bal.mb[2];
+      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithSnow(surf[2], met[2], params, snow, eb, mb);
 
       // fQe, Me positive is condensation, water flux positive to surface.  Subsurf is 0 because of snow
       mass_source[0][c] += area_fracs[2][c] * flux.M_surf;
       energy_source[0][c] += area_fracs[2][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
       snow_source[0][c] += area_fracs[2][c] * flux.M_snow;
-      new_snow[0][c] += (met.Ps + std::max(mb.Me, 0.)) * area_fracs[2][c];
+      new_snow[0][c] += (met[2].Ps + std::max(mb.Me, 0.)) * area_fracs[2][c];
 
       if (vo_->os_OK(Teuchos::VERB_EXTREME))
         *vo_->os() << "CELL " << c << " SNOW"
@@ -451,7 +411,7 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         (*qE_sm)[0][c] = area_fracs[2][c] * eb.fQm;
         (*melt_rate)[0][c] = area_fracs[2][c] * mb.Mm;
         (*snow_temp)[0][c] = snow.temp;
-        (*albedo)[0][c] += area_fracs[2][c] * surf.albedo;
+        (*albedo)[0][c] += area_fracs[2][c] * surf[2].albedo;
       }
     }
   }
@@ -570,8 +530,84 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 
 void
 SubgridEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
-        Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> > & results) {
-  AMANZI_ASSERT(false);
+        Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> > & results)
+{
+  for (const auto& result : results) result->PutScalar(0.);
+  if (wrt_key != surf_temp_key_ && wrt_key != surf_pres_key_ && wrt_key != unfrozen_fraction_key_ &&
+      wrt_key != snow_depth_key_ && wrt_key != snow_dens_key_)
+    return;
+  if (wrt_key == surf_pres_key_ && ss_topcell_based_evap_) return;
+
+  const SEBPhysics::ModelParams params;
+  const Inputs_ in = GetInputs_(S);
+  const auto& area_fracs = in.area_fracs;
+
+  // collect output vecs
+  auto& dmass_source = *results[0]->ViewComponent("cell",false);
+  auto& denergy_source = *results[1]->ViewComponent("cell",false);
+  auto& dss_mass_source = *results[2]->ViewComponent("cell",false);
+  auto& dss_energy_source = *results[3]->ViewComponent("cell",false);
+  auto& dsnow_source = *results[4]->ViewComponent("cell",false);
+  auto& dnew_snow = *results[5]->ViewComponent("cell",false);
+
+  // the balances of the current state, see UpdateFieldDerivative_()
+  unsigned int ncells = dmass_source.MyLength();
+  AMANZI_ASSERT(balances_.size() == ncells);
+  for (unsigned int c=0; c!=ncells; ++c) {
+    SEBPhysics::MetData met[3];
+    SEBPhysics::GroundProperties surf[3];
+    SEBPhysics::SnowProperties snow;
+    AmanziMesh::Entity_ID top_cell = SetupCell_(in, params, c, met, surf, snow);
+    const CellBalances_& bal = balances_[c];
+
+    // bare ground (0) and water (1) columns
+    for (int patch=0; patch!=2; ++patch) {
+      if (area_fracs[patch][c] <= 0.) continue;
+
+      SEBPhysics::StateDerivative ds;
+      if (wrt_key == surf_temp_key_) {
+        ds.ground_temp = 1.;
+      } else if (wrt_key == surf_pres_key_) {
+        ds.ground_pressure = (patch == 0 && in.surf_pres[0][c] > 101325.) ? 0. : 1.;
+      } else if (wrt_key == unfrozen_fraction_key_) {
+        ds.unfrozen_fraction = 1.;
+      }
+
+      const SEBPhysics::EnergyBalance deb = SEBPhysics::UpdateEnergyBalanceWithoutSnowDerivative(surf[patch], met[patch], params, ds);
+      const SEBPhysics::MassBalance dmb = SEBPhysics::UpdateMassBalanceWithoutSnowDerivative(surf[patch], params, bal.eb[patch], ds, deb);
+      SEBPhysics::FluxBalance dflux = SEBPhysics::UpdateFluxesWithoutSnowDerivative(surf[patch], met[patch], params, bal.mb[patch], ds, deb, dmb);
+
+      dmass_source[0][c] += area_fracs[patch][c] * dflux.M_surf;
+      denergy_source[0][c] += area_fracs[patch][c] * dflux.E_surf * 1.e-6;
+
+      double area_to_volume = in.mesh.cell_volume(c) / in.mesh_ss.cell_volume(top_cell);
+      dss_mass_source[0][top_cell] += area_fracs[patch][c] * dflux.M_subsurf * area_to_volume * params.density_water / 0.0180153;
+      dss_energy_source[0][top_cell] += area_fracs[patch][c] * dflux.E_subsurf * area_to_volume * 1.e-6;
+
+      dsnow_source[0][c] += area_fracs[patch][c] * dflux.M_snow;
+    }
+
+    // snow column, where snow.temp is the solved snow temperature
+    if (area_fracs[2][c] > 0.) {
+      SEBPhysics::StateDerivative ds;
+      if (wrt_key == surf_temp_key_) {
+        ds.ground_temp = 1.;
+      } else if (wrt_key == snow_depth_key_) {
+        ds.snow_height = 1. / area_fracs[2][c];
+      } else if (wrt_key == snow_dens_key_) {
+        ds.snow_density = 1.;
+      }
+
+      const SEBPhysics::EnergyBalance deb = SEBPhysics::UpdateEnergyBalanceWithSnowDerivative(surf[2], met[2], params, snow, ds);
+      const SEBPhysics::MassBalance dmb = SEBPhysics::UpdateMassBalanceWithSnowDerivative(surf[2], params, deb);
+      SEBPhysics::FluxBalance dflux = SEBPhysics::UpdateFluxesWithSnowDerivative(deb, dmb);
+
+      dmass_source[0][c] += area_fracs[2][c] * dflux.M_surf;
+      denergy_source[0][c] += area_fracs[2][c] * dflux.E_surf * 1.e-6;
+      dsnow_source[0][c] += area_fracs[2][c] * dflux.M_snow;
+      if (bal.mb[2].Me > 0.) dnew_snow[0][c] += area_fracs[2][c] * dmb.Me;
+    }
+  }
 }
 
 void
@@ -695,8 +731,9 @@ SubgridEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
 void
 SubgridEvaluator::UpdateFieldDerivative_(const Teuchos::Ptr<State>& S, Key wrt_key)
 {
-  Errors::Message message("SEBEvaluator: cannot differentiate with respect to anything.");
-  Exceptions::amanzi_throw(message);
+  // partial derivatives use the balances of the last evaluation
+  HasFieldChanged(S, my_keys_[0]);
+  SecondaryVariablesFieldEvaluator::UpdateFieldDerivative_(S, wrt_key);
 }
 
 
@@ -25,6 +25,13 @@ depth/geometry-based approach for water.  All snow is assumed to first cover
 water (likely ice), then cover land, as both water and snow prefer low-lying
 depressions due to gravity- and wind-driven redistributions, respectively.
 
+Partial derivatives of the sources are calculated analytically with respect to
+surface temperature, pressure, and unfrozen fraction, and snow depth and
+density, including the change in snow temperature required to maintain the
+energy balance.  Derivatives with respect to the remaining dependencies (met
+data, area fractions, albedos and emissivities, and subsurface properties) are
+taken to be zero; they are used only in preconditioners.
+
 .. _seb_subgrid_evaluator-spec:
 .. admonition:: seb_subgrid_evaluator-spec
 
@@ -99,6 +106,7 @@ depressions due to gravity- and wind-driven redistributions, respectively.
 #include "Factory.hh"
 #include "Debugger.hh"
 #include "secondary_variables_field_evaluator.hh"
+#include "seb_physics_defs.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -123,11 +131,44 @@ class SubgridEvaluator : public SecondaryVariablesFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> > & results);
 
-  // this is non-standard practice.  Implementing UpdateFieldDerivative_ to
-  // override the default chain rule behavior, instead doing a numerical
-  // finite difference
+  // Brings the sources, and so the balances cached by EvaluateField_(), up
+  // to date before applying the usual chain rule.
   virtual void UpdateFieldDerivative_(const Teuchos::Ptr<State>& S, Key wrt_key);
-  
+
+  // dependencies and meshes, viewed once per evaluation
+  struct Inputs_ {
+    const Epetra_MultiVector& qSW_in;
+    const Epetra_MultiVector& qLW_in;
+    const Epetra_MultiVector& air_temp;
+    const Epetra_MultiVector& rel_hum;
+    const Epetra_MultiVector& wind_speed;
+    const Epetra_MultiVector& Prain;
+    const Epetra_MultiVector& Psnow;
+    const Epetra_MultiVector& snow_volumetric_depth;
+    const Epetra_MultiVector& snow_dens;
+    const Epetra_MultiVector& snow_death_rate;
+    const Epetra_MultiVector& unfrozen_fraction;
+    const Epetra_MultiVector& sg_albedo;
+    const Epetra_MultiVector& emissivity;
+    const Epetra_MultiVector& area_fracs;
+    const Epetra_MultiVector& surf_pres;
+    const Epetra_MultiVector& surf_temp;
+    const Epetra_MultiVector& sat_gas;
+    const Epetra_MultiVector& poro;
+    const Epetra_MultiVector& ss_pres;
+    const AmanziMesh::Mesh& mesh;
+    const AmanziMesh::Mesh& mesh_ss;
+  };
+  Inputs_ GetInputs_(const Teuchos::Ptr<State>& S) const;
+
+  // Sets up the met data and ground of the bare (0), water (1), and snow (2)
+  // patches of surface cell c, and the snow if there is any.  Returns the
+  // subsurface cell below c.
+  AmanziMesh::Entity_ID SetupCell_(const Inputs_& in,
+          const SEBPhysics::ModelParams& params, int c,
+          SEBPhysics::MetData (&met)[3], SEBPhysics::GroundProperties (&surf)[3],
+          SEBPhysics::SnowProperties& snow) const;
+
  protected:
   Key mass_source_key_, energy_source_key_;
   Key ss_mass_source_key_, ss_energy_source_key_;
@@ -166,6 +207,19 @@ class SubgridEvaluator : public SecondaryVariablesFieldEvaluator {
                                      // table drops below the surface.
   bool ss_topcell_based_evap_;
   bool diagnostics_;
+
+  // snow temperature of the last solve in each cell, the initial guess for
+  // the next one (NaN if no snow has been seen yet)
+  std::vector<double> snow_temp_guess_;
+
+  // balances of the patches of each cell at the last evaluation, from which
+  // partial derivatives are calculated without solving for the snow
+  // temperature again
+  struct CellBalances_ {
+    SEBPhysics::EnergyBalance eb[3];
+    SEBPhysics::MassBalance mb[3];
+  };
+  std::vector<CellBalances_> balances_;
   Teuchos::RCP<Debugger> db_;
   Teuchos::RCP<Debugger> db_ss_;
   Teuchos::ParameterList plist_;
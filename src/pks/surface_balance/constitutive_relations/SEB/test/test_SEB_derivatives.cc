@@ -0,0 +1,189 @@
+#include "UnitTest++.h"
+#include "TestReporterStdout.h"
+
+#include <cmath>
+#include <functional>
+
+#include "seb_physics_defs.hh"
+#include "seb_physics_funcs.hh"
+
+using namespace Amanzi::SurfaceBalance::SEBPhysics;
+
+//
+// Checks the analytic derivatives of the surface energy balance fluxes
+// against centered finite differences of the fluxes.
+//
+struct TestSEBDerivatives {
+  ModelParams params;
+  MetData met;
+  GroundProperties surf;
+  SnowProperties snow;
+
+  TestSEBDerivatives() {
+    met.Z_Us = 2.;
+    met.Us = 3.;
+    met.QswIn = 200.;
+    met.QlwIn = 280.;
+    met.air_temp = 275.15;
+    met.relative_humidity = 0.6;
+    met.Pr = 1.e-8;
+    met.Ps = 0.;
+
+    surf.temp = 278.15;
+    surf.pressure = 101325. - 2000.;
+    surf.roughness = 0.04;
+    surf.density_w = params.density_water;
+    surf.dz = 0.1;
+    surf.albedo = 0.2;
+    surf.emissivity = 0.92;
+    surf.porosity = 0.5;
+    surf.saturation_gas = 0.4;
+    surf.unfrozen_fraction = 0.7;
+    surf.snow_death_rate = 0.;
+
+    snow.height = 0.3;
+    snow.density = 250.;
+    snow.albedo = 0.8;
+    snow.emissivity = 0.98;
+    snow.roughness = 0.004;
+  }
+
+  // apply a perturbation of size eps in the direction of ds
+  void Perturb(const StateDerivative& ds, double eps,
+               GroundProperties& surf_p, SnowProperties& snow_p) const {
+    surf_p.temp += eps * ds.ground_temp;
+    surf_p.pressure += eps * ds.ground_pressure;
+    surf_p.porosity += eps * ds.porosity;
+    surf_p.saturation_gas += eps * ds.saturation_gas;
+    surf_p.unfrozen_fraction += eps * ds.unfrozen_fraction;
+    snow_p.height += eps * ds.snow_height;
+    snow_p.density += eps * ds.snow_density;
+  }
+
+  FluxBalance FluxesWithoutSnow(const GroundProperties& surf_p) const {
+    EnergyBalance eb = UpdateEnergyBalanceWithoutSnow(surf_p, met, params);
+    MassBalance mb = UpdateMassBalanceWithoutSnow(surf_p, params, eb);
+    return UpdateFluxesWithoutSnow(surf_p, met, params, eb, mb);
+  }
+
+  FluxBalance FluxesWithSnow(const GroundProperties& surf_p, SnowProperties& snow_p) const {
+    EnergyBalance eb = UpdateEnergyBalanceWithSnow(surf_p, met, params, snow_p);
+    MassBalance mb = UpdateMassBalanceWithSnow(surf_p, params, eb);
+    return UpdateFluxesWithSnow(surf_p, met, params, snow_p, eb, mb);
+  }
+
+  FluxBalance DFluxesWithoutSnow(const StateDerivative& ds) const {
+    EnergyBalance eb = UpdateEnergyBalanceWithoutSnow(surf, met, params);
+    MassBalance mb = UpdateMassBalanceWithoutSnow(surf, params, eb);
+    EnergyBalance deb = UpdateEnergyBalanceWithoutSnowDerivative(surf, met, params, ds);
+    MassBalance dmb = UpdateMassBalanceWithoutSnowDerivative(surf, params, eb, ds, deb);
+    return UpdateFluxesWithoutSnowDerivative(surf, met, params, mb, ds, deb, dmb);
+  }
+
+  FluxBalance DFluxesWithSnow(const StateDerivative& ds) const {
+    SnowProperties snow_l(snow);
+    UpdateEnergyBalanceWithSnow(surf, met, params, snow_l);
+    EnergyBalance deb = UpdateEnergyBalanceWithSnowDerivative(surf, met, params, snow_l, ds);
+    MassBalance dmb = UpdateMassBalanceWithSnowDerivative(surf, params, deb);
+    return UpdateFluxesWithSnowDerivative(deb, dmb);
+  }
+
+  void Check(bool with_snow, const StateDerivative& ds, double eps, double rtol) const {
+    GroundProperties surf_p(surf), surf_m(surf);
+    SnowProperties snow_p(snow), snow_m(snow);
+    Perturb(ds, eps, surf_p, snow_p);
+    Perturb(ds, -eps, surf_m, snow_m);
+
+    FluxBalance fp, fm, dflux;
+    if (with_snow) {
+      fp = FluxesWithSnow(surf_p, snow_p);
+      fm = FluxesWithSnow(surf_m, snow_m);
+      dflux = DFluxesWithSnow(ds);
+    } else {
+      fp = FluxesWithoutSnow(surf_p);
+      fm = FluxesWithoutSnow(surf_m);
+      dflux = DFluxesWithoutSnow(ds);
+    }
+
+    auto check = [=](double plus, double minus, double deriv) {
+      double fd = (plus - minus) / (2*eps);
+      CHECK_CLOSE(fd, deriv, rtol * std::max(std::abs(fd), std::abs(deriv)) + 1.e-20);
+    };
+    check(fp.M_surf, fm.M_surf, dflux.M_surf);
+    check(fp.E_surf, fm.E_surf, dflux.E_surf);
+    check(fp.M_subsurf, fm.M_subsurf, dflux.M_subsurf);
+    check(fp.E_subsurf, fm.E_subsurf, dflux.E_subsurf);
+    check(fp.M_snow, fm.M_snow, dflux.M_snow);
+  }
+};
+
+
+SUITE(SEB_DERIVATIVES) {
+
+  TEST_FIXTURE(TestSEBDerivatives, BARE_GROUND_TEMPERATURE) {
+    StateDerivative ds;
+    ds.ground_temp = 1.;
+    Check(false, ds, 1.e-4, 1.e-5);
+
+    // condensation
+    met.relative_humidity = 1.;
+    surf.temp = 272.15;
+    Check(false, ds, 1.e-4, 1.e-5);
+  }
+
+  TEST_FIXTURE(TestSEBDerivatives, BARE_GROUND_PRESSURE) {
+    StateDerivative ds;
+    ds.ground_pressure = 1.;
+    Check(false, ds, 1.e-2, 1.e-5);
+
+    // within the evaporation transition width
+    surf.pressure = 1000.*params.Apa + 0.5 * params.evap_transition_width;
+    Check(false, ds, 1.e-2, 1.e-5);
+  }
+
+  TEST_FIXTURE(TestSEBDerivatives, BARE_GROUND_SOIL) {
+    StateDerivative ds;
+    ds.porosity = 0.3;
+    ds.saturation_gas = -0.7;
+    ds.unfrozen_fraction = 1.;
+    Check(false, ds, 1.e-5, 1.e-5);
+  }
+
+  TEST_FIXTURE(TestSEBDerivatives, SNOW_COLD) {
+    met.air_temp = 258.15;
+    surf.temp = 270.15;
+
+    StateDerivative ds;
+    ds.ground_temp = 1.;
+    Check(true, ds, 1.e-3, 1.e-4);
+
+    ds = StateDerivative();
+    ds.snow_height = 1.;
+    Check(true, ds, 1.e-5, 1.e-4);
+
+    ds = StateDerivative();
+    ds.snow_density = 1.;
+    Check(true, ds, 1.e-2, 1.e-4);
+
+    // snow thinner than the bare ground roughness
+    snow.height = 0.02;
+    ds = StateDerivative();
+    ds.snow_height = 1.;
+    Check(true, ds, 1.e-6, 1.e-4);
+  }
+
+  TEST_FIXTURE(TestSEBDerivatives, SNOW_MELTING) {
+    met.air_temp = 283.15;
+    met.QswIn = 400.;
+    surf.temp = 273.15;
+
+    StateDerivative ds;
+    ds.ground_temp = 1.;
+    Check(true, ds, 1.e-3, 1.e-4);
+
+    ds = StateDerivative();
+    ds.snow_height = 1.;
+    Check(true, ds, 1.e-5, 1.e-4);
+  }
+
+}
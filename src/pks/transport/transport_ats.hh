@@ -228,6 +228,9 @@ The advection-diffusion equation for component *i* may be written as
 
 // Transport
 #include "LimiterCell.hh"
+#include "BCs.hh"
+#include "PDE_Diffusion.hh"
+#include "PDE_Accumulation.hh"
 #include "MDMPartition.hh"
 #include "MultiscaleTransportPorosityPartition.hh"
 #include "TransportDomainFunction.hh"
@@ -345,6 +348,7 @@ private:
   void AdvanceSecondOrderUpwindRK1(double dT);
   void AdvanceSecondOrderUpwindRK2(double dT);
   void Advance_Dispersion_Diffusion(double t_old, double t_new);
+  void CreateDiffusionOperator_();
 
   // time integration members
   void FunctionalTimeDerivative(const double t, const Epetra_Vector& component, Epetra_Vector& f_component);
@@ -402,6 +406,7 @@ public:
   int spatial_disc_order, temporal_disc_order, limiter_model;
 
   int nsubcycles;  // output information
+  int nsubcycles_total_;
   int internal_tests;
   double tests_tolerance;
 
@@ -430,6 +435,7 @@ protected:
   Teuchos::RCP<CompositeVector> tcc_w_src;
   Teuchos::RCP<CompositeVector> tcc_tmp;  // next tcc
   Teuchos::RCP<CompositeVector> tcc;  // smart mirrow of tcc
+  Teuchos::RCP<CompositeVector> tcc_work_;  // previous subcycle's tcc
   Teuchos::RCP<Epetra_MultiVector> conserve_qty_, solid_qty_, water_qty_;
   Teuchos::RCP<const Epetra_MultiVector> flux_;
   Teuchos::RCP<const Epetra_MultiVector> ws_, ws_prev_, phi_, mol_dens_, mol_dens_prev_;
@@ -464,6 +470,12 @@ protected:
   Teuchos::RCP<MDMPartition> mdm_;
   std::vector<WhetStone::Tensor> D_;
 
+  // persistent dispersion/diffusion operator and work space
+  Teuchos::RCP<Operators::BCs> diff_bc_;
+  Teuchos::RCP<Operators::PDE_Diffusion> diff_pde_;
+  Teuchos::RCP<Operators::PDE_Accumulation> diff_acc_;
+  Teuchos::RCP<CompositeVector> diff_sol_, diff_factor_, diff_factor0_;
+
   bool flag_dispersion_;
   std::vector<int> axi_symmetry_;  // axi-symmetry direction of permeability tensor
 
@@ -18,6 +18,7 @@
 #include "Epetra_MultiVector.h"
 #include "Epetra_Import.h"
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_Time.hpp"
 
 #include "BCs.hh"
 #include "errors.hh"
@@ -233,6 +234,7 @@ void Transport_ATS::Initialize(const Teuchos::Ptr<State>& S)
 {
   // Set initial values for transport variables.
   dt_ = dt_debug_ = t_physics_ = 0.0;
+  nsubcycles_total_ = 0;
   double time = S->time();
   if (time >= 0.0) t_physics_ = time;
 
@@ -255,6 +257,9 @@ void Transport_ATS::Initialize(const Teuchos::Ptr<State>& S)
   S->RequireFieldCopy(tcc_key_, "subcycling", name_);
   tcc_tmp = S->GetFieldCopyData(tcc_key_,"subcycling", name_);
 
+  // work space for the previous subcycle's concentration, so that
+  // subcycling does not allocate
+  tcc_work_ = Teuchos::rcp(new CompositeVector(*tcc_tmp));
   
   S->RequireFieldCopy(saturation_key_, "subcycle_start", name_);
   ws_subcycle_start = S->GetFieldCopyData(saturation_key_, "subcycle_start",name_)
@@ -811,6 +816,7 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
   }
 
   int ncycles = 0, swap = 1;
+  Teuchos::Time subcycle_timer("transport subcycles", true);
   while (dt_sum < dt_MPC - 1e-6) {
     // update boundary conditions
     time = t_physics_ + dt_cycle / 2;
@@ -872,12 +878,15 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
       AddMultiscalePorosity_(t_old, t_new, t_int1, t_int2);
     }
 
-    if (! final_cycle) {  // rotate concentrations (we need new memory for tcc)
-      tcc = Teuchos::RCP<CompositeVector>(new CompositeVector(*tcc_tmp));
+    if (! final_cycle) {  // rotate concentrations into the preallocated work vector
+      *tcc_work_ = *tcc_tmp;
+      tcc = tcc_work_;
     }
 
     ncycles++;
   }
+  double subcycle_time = subcycle_timer.stop();
+  nsubcycles_total_ += ncycles;
 
   dt_ = dt_stable;  // restore the original time step (just in case)
 
@@ -895,6 +904,8 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
   if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
     *vo_->os() << ncycles << " sub-cycles, dt_stable=" << units_.OutputTime(dt_stable)
                << " [sec]  dt_MPC=" << units_.OutputTime(dt_MPC) << " [sec]" << std::endl;
+    *vo_->os() << "sub-cycle wallclock: " << subcycle_time / std::max(ncycles, 1)
+               << " [sec/sub-cycle], " << nsubcycles_total_ << " sub-cycles total" << std::endl;
 
     VV_PrintSoluteExtrema(tcc_next, dt_MPC);
   }
@@ -926,39 +937,44 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
   }
 
   if (flag_dispersion_ || flag_diffusion) {
+    // the operator, BCs, and work vectors persist across calls
+    if (diff_pde_ == Teuchos::null) CreateDiffusionOperator_();
+
     // default boundary conditions (none inside domain and Neumann on its boundary)
-    Teuchos::RCP<Operators::BCs> bc_dummy =
-        Teuchos::rcp(new Operators::BCs(mesh_, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
-    auto& bc_model = bc_dummy->bc_model();
-    auto& bc_value = bc_dummy->bc_value();
+    auto& bc_model = diff_bc_->bc_model();
+    auto& bc_value = diff_bc_->bc_value();
     PopulateBoundaryData(bc_model, bc_value, -1);
 
-    // diffusion operator
-    Teuchos::ParameterList& op_list = plist_->sublist("diffusion");
-    op_list.set("inverse", plist_->sublist("inverse"));
-
-    Operators::PDE_DiffusionFactory opfactory;
-    Teuchos::RCP<Operators::PDE_Diffusion> op1 = opfactory.Create(op_list, mesh_, bc_dummy);
-    op1->SetBCs(bc_dummy, bc_dummy);
-    Teuchos::RCP<Operators::Operator> op = op1->global_operator();
-    Teuchos::RCP<Operators::PDE_Accumulation> op2 =
-        Teuchos::rcp(new Operators::PDE_Accumulation(AmanziMesh::CELL, op));
-
-    const CompositeVectorSpace& cvs = op1->global_operator()->DomainMap();
-    CompositeVector sol(cvs), factor(cvs), factor0(cvs), source(cvs), zero(cvs);
-    zero.PutScalar(0.0);
+    Teuchos::RCP<Operators::Operator> op = diff_pde_->global_operator();
+    CompositeVector& sol = *diff_sol_;
+    CompositeVector& factor = *diff_factor_;
+    CompositeVector& factor0 = *diff_factor0_;
 
     // populate the dispersion operator (if any)
     if (flag_dispersion_) {
       CalculateDispersionTensor_(*flux_, *phi_, *ws_, *mol_dens_);
     }
 
-    int phase, num_itrs(0);
+    int phase, num_itrs(0), num_assembled(0);
     bool flag_op1(true);
     double md_change, md_old(0.0), md_new, residual(0.0);
 
-    // Disperse and diffuse aqueous components
+    // Group aqueous components by diffusion coefficient, so that all
+    // components sharing a tensor are solved against a single assembled
+    // operator and preconditioner, changing the tensor as few times as
+    // possible.
+    std::vector<std::pair<double, int> > aqueous_md(num_aqueous);
     for (int i = 0; i < num_aqueous; i++) {
+      FindDiffusionValue(component_names_[i], &md_new, &phase);
+      aqueous_md[i] = std::make_pair(md_new, i);
+    }
+    std::stable_sort(aqueous_md.begin(), aqueous_md.end(),
+                     [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+                       return a.first < b.first; });
+
+    // Disperse and diffuse aqueous components
+    for (const auto& md_i : aqueous_md) {
+      int i = md_i.second;
       FindDiffusionValue(component_names_[i], &md_new, &phase);
       md_change = md_new - md_old;
       md_old = md_new;
@@ -980,16 +996,20 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
       if (flag_op1) {
         op->Init();
         Teuchos::RCP<std::vector<WhetStone::Tensor> > Dptr = Teuchos::rcpFromRef(D_);
-        op1->Setup(Dptr, Teuchos::null, Teuchos::null);
-        op1->UpdateMatrices(Teuchos::null, Teuchos::null);
+        diff_pde_->Setup(Dptr, Teuchos::null, Teuchos::null);
+        diff_pde_->UpdateMatrices(Teuchos::null, Teuchos::null);
 
         // add accumulation term
         Epetra_MultiVector& fac = *factor.ViewComponent("cell");
         for (int c = 0; c < ncells_owned; c++) {
           fac[0][c] = (*phi_)[0][c] * (*ws_)[0][c] * (*mol_dens_)[0][c];
         }
-        op2->AddAccumulationDelta(sol, factor, factor, dt_MPC, "cell");
-        op1->ApplyBCs(true, true, true);
+        diff_acc_->AddAccumulationDelta(sol, factor, factor, dt_MPC, "cell");
+        diff_pde_->ApplyBCs(true, true, true);
+
+        // reuse this operator for all components sharing the tensor
+        flag_op1 = false;
+        num_assembled++;
 
       } else {
         Epetra_MultiVector& rhs_cell = *op->rhs()->ViewComponent("cell");
@@ -1023,7 +1043,7 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
           int nbfaces = tcc_tmp_bf.MyLength();
           for (int bf=0; bf!=nbfaces; ++bf) {
             AmanziMesh::Entity_ID f = face_map.LID(vandalay_map.GID(bf));
-            tcc_tmp_bf[i][bf] =  sol_faces[i][f];
+            tcc_tmp_bf[i][bf] =  sol_faces[0][f];
           }
         }
       }
@@ -1052,17 +1072,19 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
         sol.ViewComponent("face")->PutScalar(0.0);
       }
 
+      // boundary data differs per gaseous component, so always reassemble
       op->Init();
       Teuchos::RCP<std::vector<WhetStone::Tensor> > Dptr = Teuchos::rcpFromRef(D_);
-      op1->Setup(Dptr, Teuchos::null, Teuchos::null);
-      op1->UpdateMatrices(Teuchos::null, Teuchos::null);
+      diff_pde_->Setup(Dptr, Teuchos::null, Teuchos::null);
+      diff_pde_->UpdateMatrices(Teuchos::null, Teuchos::null);
+      num_assembled++;
 
       // add boundary conditions and sources for gaseous components
       PopulateBoundaryData(bc_model, bc_value, i);
 
       Epetra_MultiVector& rhs_cell = *op->rhs()->ViewComponent("cell");
       ComputeAddSourceTerms(t_new, 1.0, rhs_cell, i, i);
-      op1->ApplyBCs(true, true, true);
+      diff_pde_->ApplyBCs(true, true, true);
 
       // add accumulation term
       Epetra_MultiVector& fac1 = *factor.ViewComponent("cell");
@@ -1073,7 +1095,7 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
         fac0[0][c] = (*phi_)[0][c] * (1.0 - (*ws_prev_)[0][c]) * (*mol_dens_prev_)[0][c];
         if ((*ws_)[0][c] == 1.0) fac1[0][c] = 1.0 * (*mol_dens_)[0][c];  // hack so far
       }
-      op2->AddAccumulationDelta(sol, factor0, factor, dt_MPC, "cell");
+      diff_acc_->AddAccumulationDelta(sol, factor0, factor, dt_MPC, "cell");
 
       CompositeVector& rhs = *op->rhs();
       int ierr = op->ApplyInverse(rhs, sol);
@@ -1094,13 +1116,38 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
     if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
       Teuchos::OSTab tab = vo_->getOSTab();
       *vo_->os() << "dispersion solver ||r||=" << residual / num_components
-                 << " itrs=" << num_itrs / num_components << std::endl;
+                 << " itrs=" << num_itrs / num_components
+                 << " assemblies=" << num_assembled << std::endl;
     }
   }
 
 }
 
 
+/* *******************************************************************
+* Create the dispersion/diffusion operator, its boundary conditions, and
+* work vectors.  These depend only on the mesh and the parameter list, so
+* they are created once and reused across steps.
+******************************************************************* */
+void Transport_ATS::CreateDiffusionOperator_()
+{
+  diff_bc_ = Teuchos::rcp(new Operators::BCs(mesh_, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
+
+  Teuchos::ParameterList& op_list = plist_->sublist("diffusion");
+  op_list.set("inverse", plist_->sublist("inverse"));
+
+  Operators::PDE_DiffusionFactory opfactory;
+  diff_pde_ = opfactory.Create(op_list, mesh_, diff_bc_);
+  diff_pde_->SetBCs(diff_bc_, diff_bc_);
+  diff_acc_ = Teuchos::rcp(new Operators::PDE_Accumulation(AmanziMesh::CELL, diff_pde_->global_operator()));
+
+  const CompositeVectorSpace& cvs = diff_pde_->global_operator()->DomainMap();
+  diff_sol_ = Teuchos::rcp(new CompositeVector(cvs));
+  diff_factor_ = Teuchos::rcp(new CompositeVector(cvs));
+  diff_factor0_ = Teuchos::rcp(new CompositeVector(cvs));
+}
+
+
 /* *******************************************************************
 * Add multiscale porosity model on sub interval [t_int1, t_int2]:
 *   d(VWC_f)/dt -= G_s, d(VWC_m) = G_s
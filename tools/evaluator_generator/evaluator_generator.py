@@ -89,8 +89,6 @@ class EvalGen(object):
 
     def renderKeyEpetraVector(self):
         return '\n'.join([render('evaluator_keyEpetraVector.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
-    def renderKeyEpetraVectorIndented(self):
-        return '\n'.join([render('evaluator_keyEpetraVectorIndented.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
 
     def renderMyMethodArgs(self):
         return ", ".join(["%s_v[0][i]"%var for var in self.vars])
@@ -98,37 +96,39 @@ class EvalGen(object):
     def renderMyMethodDeclarationArgs(self):
         return ", ".join(["double %s"%var for var in self.vars])
 
-    def renderEvaluateModel(self):
+    def renderMyBatchArgs(self):
+        return ", ".join(["%s_v"%var for var in self.vars])
+
+    def renderMyBatchCallArgs(self):
+        return ", ".join(["%s[i]"%var for var in self.vars])
+
+    def renderMyBatchDeclarationArgs(self):
+        return ", ".join(["const double* __restrict__ %s"%var for var in self.vars])
+
+    def derivMethod(self, arg):
+        return "D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")]))
+
+    def renderEvalLoop(self, method, indent=0):
         d = dict()
-        d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
-        d['myKeyMethod'] = self.d['myKeyMethod']
-        d['myMethodArgs'] = self.renderMyMethodArgs()
-        return render('evaluator_evaluateModel.cc', d)
+        d['keyEpetraVectors'] = self.renderKeyEpetraVector()
+        d['myMethod'] = method
+        d['myBatchArgs'] = self.renderMyBatchArgs()
+        return '\n'.join([(' '*indent + line if len(line) > 0 else line) for line in render('evaluator_evalLoop.cc', d).split('\n')])
+
+    def renderEvaluateModel(self):
+        return self.renderEvalLoop(self.d['myKeyMethod'])
 
     def renderEvaluateDerivs(self):
         wrt_list = []
-
-        def getDict(arg,var):
-            d = dict(arg=arg,var=var)
-            d['keyEpetraVectorList'] = self.renderKeyEpetraVectorIndented()
-            d['myKeyMethod'] = self.d['myKeyMethod']
-            d['wrtMethod'] = ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
-            d['myMethodArgs'] = self.renderMyMethodArgs()
-            return d
-        
-        if len(self.args) > 0:
-            d = getDict(self.args[0], self.vars[0])
-            d['if_elseif'] = render('evaluator_ifWRT.cc', d)
-            wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
-
-        if len(self.args) > 1:
-            for arg,var in zip(self.args[1:],self.vars[1:]):
-                d = getDict(arg,var)
-                d['if_elseif'] = render('evaluator_elseifWRT.cc', d)
-                wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
+        for i,(arg,var) in enumerate(zip(self.args,self.vars)):
+            if i == 0:
+                if_elseif = render('evaluator_ifWRT.cc', dict(arg=arg,var=var))
+            else:
+                if_elseif = render('evaluator_elseifWRT.cc', dict(arg=arg,var=var))
+            wrt_list.append('\n'.join([if_elseif, self.renderEvalLoop(self.derivMethod(arg), 2)]))
 
         wrt_list.append('\n'.join(["  } else {",
-                                   "    ASSERT(0);",
+                                   "    AMANZI_ASSERT(0);",
                                    "  }"]))
 
         return "\n\n".join(wrt_list)
@@ -139,14 +139,14 @@ class EvalGen(object):
 
     def renderModelDerivDeclarations(self):
         return '\n'.join([render('model_declaration.hh',
-                                 dict(myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
+                                 dict(myMethod=self.derivMethod(arg),
                                       myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'])) for arg in self.args])
 
     def renderModelMethodImplementation(self):
         if self.expression is not None:
             implementation = ccode(self.expression)
         else:
-            implementation = "ASSERT(False)"
+            implementation = "AMANZI_ASSERT(false)"
         return render('model_methodImplementation.cc', dict(evalClassName=self.d['evalClassName'],
                                                             myMethod=self.d['myKeyMethod'],
                                                             myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
@@ -160,14 +160,30 @@ class EvalGen(object):
                 print("differentiation of", self.expression, "with respect to", var)
                 implementation = ccode(self.expression.diff(var))
             else:
-                implementation = "ASSERT(False)"
+                implementation = "AMANZI_ASSERT(false)"
             impls.append(render('model_methodImplementation.cc',
                                 dict(evalClassName=self.d['evalClassName'],
-                                     myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
+                                     myMethod=self.derivMethod(arg),
                                      myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
                                      myMethodImplementation=implementation)))
         return '\n\n'.join(impls)
     
+    def renderModelBatchDeclarations(self):
+        methods = [self.d['myKeyMethod'],] + [self.derivMethod(arg) for arg in self.args]
+        return '\n'.join([render('model_batchDeclaration.hh',
+                                 dict(myMethod=method,
+                                      myBatchDeclarationArgs=self.renderMyBatchDeclarationArgs()))
+                          for method in methods])
+
+    def renderModelBatchImplementations(self):
+        methods = [self.d['myKeyMethod'],] + [self.derivMethod(arg) for arg in self.args]
+        return '\n\n'.join([render('model_batchImplementation.cc',
+                                    dict(evalClassName=self.d['evalClassName'],
+                                         myMethod=method,
+                                         myBatchDeclarationArgs=self.renderMyBatchDeclarationArgs(),
+                                         myBatchArgs=self.renderMyBatchCallArgs()))
+                             for method in methods])
+
     def renderModelParamDeclarations(self):
         return '\n'.join(['  %s %s;'%p for p in self.pars])
 
@@ -195,10 +211,12 @@ class EvalGen(object):
 
         self.d['modelMethodDeclaration'] = self.renderModelMethodDeclaration()
         self.d['modelDerivDeclarationList'] = self.renderModelDerivDeclarations()
+        self.d['modelBatchDeclarationList'] = self.renderModelBatchDeclarations()
         self.d['paramDeclarationList'] = self.renderModelParamDeclarations()
 
         self.d['modelMethodImplementation'] = self.renderModelMethodImplementation()
         self.d['modelDerivImplementationList'] = self.renderModelDerivImplementations()
+        self.d['modelBatchImplementationList'] = self.renderModelBatchImplementations()
         self.d['modelInitializeParamsList'] = self.renderModelParamInitializations()
 
 def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parameters, **kwargs):
@@ -258,7 +276,8 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
     files = ["evaluator.hh", "evaluator.cc", "evaluator_reg.hh", "model.hh", "model.cc"]
     for outfile in files:
         with open(os.path.join(directory, "%s_%s"%(name,outfile)), 'w') as fid:
-            fid.write(render(outfile, eg.d))
+            text = render(outfile, eg.d)
+            fid.write(text if text.endswith('\n') else text+'\n')
 
 
       
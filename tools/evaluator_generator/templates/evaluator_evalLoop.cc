@@ -1,10 +1,8 @@
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {{
 {keyEpetraVectors}
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    double* result_v = (*result->ViewComponent(*comp,false))[0];
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {{
-      result_v[0][i] = model_->{myMethod}({myMethodArgs});
-    }}
+    model_->{myMethod}(ncomp, {myBatchArgs}, result_v);
   }}
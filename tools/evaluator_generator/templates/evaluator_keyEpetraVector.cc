@@ -1 +1 @@
-    const Epetra_MultiVector& {var}_v = *{var}->ViewComponent(*comp, false);
+    const double* {var}_v = (*{var}->ViewComponent(*comp, false))[0];
@@ -35,6 +35,10 @@ void
 
 {modelDerivImplementationList}
 
+
+// batched kernels
+{modelBatchImplementationList}
+
 }} //namespace
 }} //namespace
 }} //namespace
@@ -23,6 +23,11 @@ class {evalClassName}Model {{
 {modelMethodDeclaration}
 
 {modelDerivDeclarationList}
+
+  // Batched kernels over n contiguous values.  These are implemented in the
+  // same translation unit as the pointwise methods above, which are inlined
+  // into loops the compiler can vectorize.  Arrays may not alias.
+{modelBatchDeclarationList}
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -0,0 +1,2 @@
+  void {myMethod}(int n, {myBatchDeclarationArgs},
+        double* __restrict__ result) const;
@@ -0,0 +1,8 @@
+void
+{evalClassName}Model::{myMethod}(int n, {myBatchDeclarationArgs},
+        double* __restrict__ result) const
+{{
+  for (int i=0; i!=n; ++i) {{
+    result[i] = {myMethod}({myBatchArgs});
+  }}
+}}